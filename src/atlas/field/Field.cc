@@ -183,10 +183,22 @@ void Field::set_dirty( bool value ) const {
     return get()->set_dirty( value );
 }
 
+void Field::set_single_precision_halo( bool value ) {
+    get()->set_single_precision_halo( value );
+}
+
+bool Field::single_precision_halo() const {
+    return get()->single_precision_halo();
+}
+
 void Field::haloExchange( bool on_device ) const {
     get()->haloExchange( on_device );
 }
 
+parallel::HaloExchangeHandle Field::haloExchangeStart( bool on_device ) const {
+    return get()->haloExchangeStart( on_device );
+}
+
 // -- dangerous methods
 template <typename DATATYPE>
 DATATYPE const* Field::data() const {
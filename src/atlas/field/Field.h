@@ -19,6 +19,7 @@
 #include "atlas/array/ArrayShape.h"
 #include "atlas/array/DataType.h"
 #include "atlas/array_fwd.h"
+#include "atlas/parallel/HaloExchangeHandle.h"
 #include "atlas/util/ObjectHandle.h"
 
 namespace eckit {
@@ -151,8 +152,18 @@ public:
 
     void set_dirty( bool = true ) const;
 
+    /// @brief Send the halo of this double precision field as float in halo exchanges
+    ///
+    /// This halves the communicated volume, at the cost of the halo no longer being bit-exact.
+    /// Off by default.
+    void set_single_precision_halo( bool = true );
+    bool single_precision_halo() const;
+
     void haloExchange( bool on_device = false ) const;
 
+    /// @brief Start a non-blocking halo exchange; the halo is valid after the returned handle's wait()
+    parallel::HaloExchangeHandle haloExchangeStart( bool on_device = false ) const;
+
     // -- dangerous methods
     template <typename DATATYPE>
     DATATYPE const* host_data() const;
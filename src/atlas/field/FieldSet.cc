@@ -12,6 +12,7 @@
 
 #include "atlas/field/Field.h"
 #include "atlas/field/FieldSet.h"
+#include "atlas/functionspace/FunctionSpace.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/runtime/Exception.h"
 
@@ -54,9 +55,38 @@ Field& FieldSetImpl::field( const std::string& name ) const {
 }
 
 void FieldSetImpl::haloExchange( bool on_device ) const {
+    haloExchangeStart( on_device ).wait();
+}
+
+parallel::HaloExchangeHandle FieldSetImpl::haloExchangeStart( bool on_device ) const {
+    // Dirty fields are grouped per function space, so that each function space can
+    // exchange its group of fields with a single message per neighbouring task
+    std::vector<FunctionSpace> functionspaces;
+    std::vector<FieldSet> groups;
     for ( idx_t i = 0; i < size(); ++i ) {
-        field( i ).haloExchange( on_device );
+        const Field& f = field( i );
+        if ( !f.dirty() ) {
+            continue;
+        }
+        ATLAS_ASSERT( f.functionspace() );
+        size_t g = 0;
+        while ( g < functionspaces.size() && functionspaces[g].get() != f.functionspace().get() ) {
+            ++g;
+        }
+        if ( g == functionspaces.size() ) {
+            functionspaces.emplace_back( f.functionspace() );
+            groups.emplace_back();
+        }
+        groups[g].add( f );
+    }
+
+    parallel::HaloExchangeHandle handle;
+    for ( size_t g = 0; g < groups.size(); ++g ) {
+        handle.append( functionspaces[g].haloExchangeStart( groups[g], on_device ) );
+        const FieldSet& group = groups[g];
+        handle.append( [group]() { group.set_dirty( false ); } );
     }
+    return handle;
 }
 
 void FieldSetImpl::set_dirty( bool value ) const {
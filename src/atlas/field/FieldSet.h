@@ -84,6 +84,7 @@ public:  // methods
     const_iterator cend() const { return fields_.end(); }
 
     void haloExchange( bool on_device = false ) const;
+    parallel::HaloExchangeHandle haloExchangeStart( bool on_device = false ) const;
     void set_dirty( bool = true ) const;
 
 protected:                                // data
@@ -162,6 +163,11 @@ public:  // methods
     const_iterator cend() const { return get()->end(); }
 
     void haloExchange( bool on_device = false ) const { get()->haloExchange( on_device ); }
+
+    /// @brief Start a non-blocking halo exchange of all fields; halos are valid after the returned handle's wait()
+    parallel::HaloExchangeHandle haloExchangeStart( bool on_device = false ) const {
+        return get()->haloExchangeStart( on_device );
+    }
     void set_dirty( bool = true ) const;
 };
 
@@ -159,6 +159,17 @@ void FieldImpl::haloExchange( bool on_device ) const {
     }
 }
 
+parallel::HaloExchangeHandle FieldImpl::haloExchangeStart( bool on_device ) const {
+    parallel::HaloExchangeHandle handle;
+    if ( dirty() ) {
+        ATLAS_ASSERT( functionspace() );
+        Field field( this );
+        handle = functionspace().haloExchangeStart( field, on_device );
+        handle.append( [field]() { field.set_dirty( false ); } );
+    }
+    return handle;
+}
+
 
 // ------------------------------------------------------------------
 
@@ -21,6 +21,7 @@
 #include "atlas/array.h"
 #include "atlas/array/ArrayUtil.h"
 #include "atlas/array/DataType.h"
+#include "atlas/parallel/HaloExchangeHandle.h"
 #include "atlas/util/Metadata.h"
 
 namespace eckit {
@@ -153,6 +154,9 @@ public:  // Destructor
 
     void set_dirty( bool = true ) const;
 
+    void set_single_precision_halo( bool value = true ) { metadata().set( "single_precision_halo", value ); }
+    bool single_precision_halo() const { return metadata().getBool( "single_precision_halo", false ); }
+
     // -- dangerous methods
     template <typename DATATYPE>
     DATATYPE const* host_data() const {
@@ -190,6 +194,7 @@ public:  // Destructor
     void reactivateHostWriteViews() const { array_->reactivateHostWriteViews(); }
 
     void haloExchange( bool on_device = false ) const;
+    parallel::HaloExchangeHandle haloExchangeStart( bool on_device = false ) const;
 
 private:  // methods
     void print( std::ostream& os, bool dump = false ) const;
@@ -16,6 +16,7 @@
 
 #include "atlas/array/MakeView.h"
 #include "atlas/functionspace/CellColumns.h"
+#include "atlas/functionspace/detail/GatherFieldSet.h"
 #include "atlas/library/config.h"
 #include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/IsGhostNode.h"
@@ -44,29 +45,6 @@ namespace atlas {
 namespace functionspace {
 namespace detail {
 
-namespace {
-template <typename T>
-array::LocalView<T, 3> make_leveled_view( const Field& field ) {
-    using namespace array;
-    if ( field.levels() ) {
-        if ( field.variables() ) {
-            return make_view<T, 3>( field ).slice( Range::all(), Range::all(), Range::all() );
-        }
-        else {
-            return make_view<T, 2>( field ).slice( Range::all(), Range::all(), Range::dummy() );
-        }
-    }
-    else {
-        if ( field.variables() ) {
-            return make_view<T, 2>( field ).slice( Range::all(), Range::dummy(), Range::all() );
-        }
-        else {
-            return make_view<T, 1>( field ).slice( Range::all(), Range::dummy(), Range::dummy() );
-        }
-    }
-}
-}  // namespace
-
 class CellColumnsHaloExchangeCache : public util::Cache<std::string, parallel::HaloExchange>,
                                      public mesh::detail::MeshObserver {
 private:
@@ -93,7 +71,7 @@ private:
 
     static value_type* create( const Mesh& mesh ) {
         mesh.get()->attachObserver( instance() );
-        value_type* value = new value_type();
+        value_type* value = new value_type( "CellColumns" );
         value->setup( array::make_view<int, 1>( mesh.cells().partition() ).data(),
                       array::make_view<idx_t, 1>( mesh.cells().remote_index() ).data(), REMOTE_IDX_BASE,
                       mesh.cells().size() );
@@ -127,7 +105,7 @@ private:
 
     static value_type* create( const Mesh& mesh ) {
         mesh.get()->attachObserver( instance() );
-        value_type* value = new value_type();
+        value_type* value = new value_type( "CellColumns" );
         value->setup( array::make_view<int, 1>( mesh.cells().partition() ).data(),
                       array::make_view<idx_t, 1>( mesh.cells().remote_index() ).data(), REMOTE_IDX_BASE,
                       array::make_view<gidx_t, 1>( mesh.cells().global_index() ).data(), mesh.cells().size() );
@@ -335,7 +313,9 @@ void dispatch_haloExchange( Field& field, const parallel::HaloExchange& halo_exc
         halo_exchange.template execute<float, RANK>( field.array(), on_device );
     }
     else if ( field.datatype() == array::DataType::kind<double>() ) {
-        halo_exchange.template execute<double, RANK>( field.array(), on_device );
+        const auto precision =
+            field.single_precision_halo() ? parallel::WirePrecision::Single : parallel::WirePrecision::Native;
+        halo_exchange.template execute<double, RANK>( field.array(), on_device, precision );
     }
     else {
         throw_Exception( "datatype not supported", Here() );
@@ -383,35 +363,18 @@ void CellColumns::gather( const FieldSet& local_fieldset, FieldSet& global_field
     ATLAS_ASSERT( local_fieldset.size() == global_fieldset.size() );
 
     for ( idx_t f = 0; f < local_fieldset.size(); ++f ) {
-        const Field& loc      = local_fieldset[f];
-        Field& glb            = global_fieldset[f];
-        const idx_t nb_fields = 1;
-        idx_t root( 0 );
-        glb.metadata().get( "owner", root );
-        if ( loc.datatype() == array::DataType::kind<int>() ) {
-            parallel::Field<int const> loc_field( make_leveled_view<int>( loc ) );
-            parallel::Field<int> glb_field( make_leveled_view<int>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<long>() ) {
-            parallel::Field<long const> loc_field( make_leveled_view<long>( loc ) );
-            parallel::Field<long> glb_field( make_leveled_view<long>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<float>() ) {
-            parallel::Field<float const> loc_field( make_leveled_view<float>( loc ) );
-            parallel::Field<float> glb_field( make_leveled_view<float>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<double>() ) {
-            parallel::Field<double const> loc_field( make_leveled_view<double>( loc ) );
-            parallel::Field<double> glb_field( make_leveled_view<double>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else {
+        const array::DataType datatype = local_fieldset[f].datatype();
+        if ( datatype != array::DataType::kind<int>() && datatype != array::DataType::kind<long>() &&
+             datatype != array::DataType::kind<float>() && datatype != array::DataType::kind<double>() ) {
             throw_Exception( "datatype not supported", Here() );
         }
     }
+
+    // Fields with different owners are gathered concurrently, see GatherScatter::gather
+    gather_fieldset<int>( gather(), local_fieldset, global_fieldset );
+    gather_fieldset<long>( gather(), local_fieldset, global_fieldset );
+    gather_fieldset<float>( gather(), local_fieldset, global_fieldset );
+    gather_fieldset<double>( gather(), local_fieldset, global_fieldset );
 }
 
 void CellColumns::gather( const Field& local, Field& global ) const {
@@ -71,8 +71,8 @@ public:
     virtual void haloExchange( const Field&, bool on_device = false ) const override;
     const parallel::HaloExchange& halo_exchange() const;
 
-    void gather( const FieldSet&, FieldSet& ) const;
-    void gather( const Field&, Field& ) const;
+    void gather( const FieldSet&, FieldSet& ) const override;
+    void gather( const Field&, Field& ) const override;
     const parallel::GatherScatter& gather() const;
 
     void scatter( const FieldSet&, FieldSet& ) const;
@@ -58,6 +58,38 @@ void FunctionSpace::haloExchange( const FieldSet& fields, bool on_device ) const
     return get()->haloExchange( fields, on_device );
 }
 
+void FunctionSpace::haloExchange( const FieldSet& fields, const eckit::Configuration& config ) const {
+    return get()->haloExchange( fields, config );
+}
+
+void FunctionSpace::haloExchange( const Field& field, const eckit::Configuration& config ) const {
+    return get()->haloExchange( field, config );
+}
+
+parallel::HaloExchangeHandle FunctionSpace::haloExchangeStart( const FieldSet& fields, bool on_device ) const {
+    return get()->haloExchangeStart( fields, on_device );
+}
+
+parallel::HaloExchangeHandle FunctionSpace::haloExchangeStart( const Field& field, bool on_device ) const {
+    return get()->haloExchangeStart( field, on_device );
+}
+
+void FunctionSpace::adjointHaloExchange( const FieldSet& fields, bool on_device ) const {
+    return get()->adjointHaloExchange( fields, on_device );
+}
+
+void FunctionSpace::adjointHaloExchange( const Field& field, bool on_device ) const {
+    return get()->adjointHaloExchange( field, on_device );
+}
+
+void FunctionSpace::gather( const FieldSet& local, FieldSet& global ) const {
+    return get()->gather( local, global );
+}
+
+void FunctionSpace::gather( const Field& local, Field& global ) const {
+    return get()->gather( local, global );
+}
+
 
 template <typename DATATYPE>
 Field FunctionSpace::createField() const {
@@ -13,6 +13,7 @@
 #include <string>
 
 #include "atlas/library/config.h"
+#include "atlas/parallel/HaloExchangeHandle.h"
 #include "atlas/util/ObjectHandle.h"
 
 namespace eckit {
@@ -55,6 +56,21 @@ public:
     void haloExchange( const FieldSet&, bool on_device = false ) const;
     void haloExchange( const Field&, bool on_device = false ) const;
 
+    /// @brief Halo exchange with options, e.g. option::halo(1) to only exchange the first halo layer
+    void haloExchange( const FieldSet&, const eckit::Configuration& ) const;
+    void haloExchange( const Field&, const eckit::Configuration& ) const;
+
+    parallel::HaloExchangeHandle haloExchangeStart( const FieldSet&, bool on_device = false ) const;
+    parallel::HaloExchangeHandle haloExchangeStart( const Field&, bool on_device = false ) const;
+
+    /// @brief Adjoint of haloExchange, adding halo values to the values they are copies of
+    void adjointHaloExchange( const FieldSet&, bool on_device = false ) const;
+    void adjointHaloExchange( const Field&, bool on_device = false ) const;
+
+    /// @brief Gather local fields into global fields, each on the task given by its "owner" metadata
+    void gather( const FieldSet&, FieldSet& ) const;
+    void gather( const Field&, Field& ) const;
+
     idx_t size() const;
 };
 
@@ -17,6 +17,7 @@
 #include "atlas/field/Field.h"
 #include "atlas/field/FieldSet.h"
 #include "atlas/functionspace/NodeColumns.h"
+#include "atlas/functionspace/detail/GatherFieldSet.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/library/config.h"
 #include "atlas/mesh/IsGhostNode.h"
@@ -43,31 +44,6 @@ namespace atlas {
 namespace functionspace {
 namespace detail {
 
-namespace {
-
-template <typename T>
-array::LocalView<T, 3> make_leveled_view( const Field& field ) {
-    using namespace array;
-    if ( field.levels() ) {
-        if ( field.variables() ) {
-            return make_view<T, 3>( field ).slice( Range::all(), Range::all(), Range::all() );
-        }
-        else {
-            return make_view<T, 2>( field ).slice( Range::all(), Range::all(), Range::dummy() );
-        }
-    }
-    else {
-        if ( field.variables() ) {
-            return make_view<T, 2>( field ).slice( Range::all(), Range::dummy(), Range::all() );
-        }
-        else {
-            return make_view<T, 1>( field ).slice( Range::all(), Range::dummy(), Range::dummy() );
-        }
-    }
-}
-
-}  // namespace
-
 class NodeColumnsHaloExchangeCache : public util::Cache<std::string, parallel::HaloExchange>,
                                      public mesh::detail::MeshObserver {
 private:
@@ -84,7 +60,7 @@ public:
         return Base::get_or_create( key( *mesh.get(), halo ), creator );
     }
     void onMeshDestruction( mesh::detail::MeshImpl& mesh ) override {
-        for ( long jhalo = 1; jhalo < mesh::Halo( mesh ).size(); ++jhalo ) {
+        for ( long jhalo = 0; jhalo <= mesh::Halo( mesh ).size(); ++jhalo ) {
             remove( key( mesh, jhalo ) );
         }
     }
@@ -99,7 +75,7 @@ private:
     static value_type* create( const Mesh& mesh, long halo ) {
         mesh.get()->attachObserver( instance() );
 
-        value_type* value = new value_type();
+        value_type* value = new value_type( "NodeColumns[halo=" + std::to_string( halo ) + "]" );
 
         std::ostringstream ss;
         ss << "nb_nodes_including_halo[" << halo << "]";
@@ -140,7 +116,7 @@ private:
     static value_type* create( const Mesh& mesh ) {
         mesh.get()->attachObserver( instance() );
 
-        value_type* value = new value_type();
+        value_type* value = new value_type( "NodeColumns" );
 
         mesh::IsGhostNode is_ghost( mesh.nodes() );
         std::vector<int> mask( mesh.nodes().size() );
@@ -346,41 +322,147 @@ Field NodeColumns::createField( const Field& other, const eckit::Configuration&
 namespace {
 
 template <int RANK>
-void dispatch_haloExchange( Field& field, const parallel::HaloExchange& halo_exchange, bool on_device ) {
+parallel::HaloExchangeHandle dispatch_haloExchangeStart( Field& field, const parallel::HaloExchange& halo_exchange,
+                                                         bool on_device ) {
+    parallel::HaloExchangeHandle handle;
+    if ( field.datatype() == array::DataType::kind<int>() ) {
+        handle = halo_exchange.template start<int, RANK>( field.array(), on_device );
+    }
+    else if ( field.datatype() == array::DataType::kind<long>() ) {
+        handle = halo_exchange.template start<long, RANK>( field.array(), on_device );
+    }
+    else if ( field.datatype() == array::DataType::kind<float>() ) {
+        handle = halo_exchange.template start<float, RANK>( field.array(), on_device );
+    }
+    else if ( field.datatype() == array::DataType::kind<double>() ) {
+        const auto precision =
+            field.single_precision_halo() ? parallel::WirePrecision::Single : parallel::WirePrecision::Native;
+        handle = halo_exchange.template start<double, RANK>( field.array(), on_device, precision );
+    }
+    else {
+        throw_Exception( "datatype not supported", Here() );
+    }
+    return handle;
+}
+
+template <int RANK>
+void dispatch_adjointHaloExchange( Field& field, const parallel::HaloExchange& halo_exchange, bool on_device ) {
     if ( field.datatype() == array::DataType::kind<int>() ) {
-        halo_exchange.template execute<int, RANK>( field.array(), on_device );
+        halo_exchange.template execute_adjoint<int, RANK>( field.array(), on_device );
     }
     else if ( field.datatype() == array::DataType::kind<long>() ) {
-        halo_exchange.template execute<long, RANK>( field.array(), on_device );
+        halo_exchange.template execute_adjoint<long, RANK>( field.array(), on_device );
     }
     else if ( field.datatype() == array::DataType::kind<float>() ) {
-        halo_exchange.template execute<float, RANK>( field.array(), on_device );
+        halo_exchange.template execute_adjoint<float, RANK>( field.array(), on_device );
     }
     else if ( field.datatype() == array::DataType::kind<double>() ) {
-        halo_exchange.template execute<double, RANK>( field.array(), on_device );
+        halo_exchange.template execute_adjoint<double, RANK>( field.array(), on_device );
     }
     else {
         throw_Exception( "datatype not supported", Here() );
     }
-    field.set_dirty( false );
+    field.set_dirty( true );
 }
 }  // namespace
 
 void NodeColumns::haloExchange( const FieldSet& fieldset, bool on_device ) const {
+    haloExchangeStart( fieldset, on_device ).wait();
+}
+
+void NodeColumns::haloExchange( const Field& field, bool on_device ) const {
+    FieldSet fieldset;
+    fieldset.add( field );
+    haloExchange( fieldset, on_device );
+}
+
+void NodeColumns::haloExchange( const FieldSet& fieldset, const eckit::Configuration& config ) const {
+    start_halo_exchange( fieldset, config.getBool( "on_device", false ), config.getInt( "halo", halo_.size() ) ).wait();
+}
+
+void NodeColumns::haloExchange( const Field& field, const eckit::Configuration& config ) const {
+    FieldSet fieldset;
+    fieldset.add( field );
+    haloExchange( fieldset, config );
+}
+
+parallel::HaloExchangeHandle NodeColumns::haloExchangeStart( const FieldSet& fieldset, bool on_device ) const {
+    return start_halo_exchange( fieldset, on_device, halo_.size() );
+}
+
+parallel::HaloExchangeHandle NodeColumns::start_halo_exchange( const FieldSet& fieldset, bool on_device,
+                                                               idx_t halo ) const {
+    const parallel::HaloExchange& halo_exchange = this->halo_exchange( halo );
+
+    // Only a complete exchange leaves the fields clean, once it has been waited for
+    const bool complete = halo >= halo_.size();
+
+    parallel::HaloExchangeHandle handle;
+    if ( fieldset.size() > 1 && !on_device ) {
+        // Fused exchange: a single message per neighbouring task for all fields of the same wire precision
+        std::vector<array::Array*> arrays;
+        std::vector<array::Array*> single_precision_arrays;
+        for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+            Field& field = const_cast<FieldSet&>( fieldset )[f];
+            ( field.single_precision_halo() ? single_precision_arrays : arrays ).emplace_back( &field.array() );
+        }
+        if ( !arrays.empty() ) {
+            handle.append( halo_exchange.start( arrays ) );
+        }
+        if ( !single_precision_arrays.empty() ) {
+            handle.append( halo_exchange.start( single_precision_arrays, parallel::WirePrecision::Single ) );
+        }
+        if ( complete ) {
+            handle.append( [fieldset]() { fieldset.set_dirty( false ); } );
+        }
+        return handle;
+    }
+    for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+        Field& field = const_cast<FieldSet&>( fieldset )[f];
+        switch ( field.rank() ) {
+            case 1:
+                handle.append( dispatch_haloExchangeStart<1>( field, halo_exchange, on_device ) );
+                break;
+            case 2:
+                handle.append( dispatch_haloExchangeStart<2>( field, halo_exchange, on_device ) );
+                break;
+            case 3:
+                handle.append( dispatch_haloExchangeStart<3>( field, halo_exchange, on_device ) );
+                break;
+            case 4:
+                handle.append( dispatch_haloExchangeStart<4>( field, halo_exchange, on_device ) );
+                break;
+            default:
+                throw_Exception( "Rank not supported", Here() );
+        }
+    }
+    if ( complete ) {
+        handle.append( [fieldset]() { fieldset.set_dirty( false ); } );
+    }
+    return handle;
+}
+
+parallel::HaloExchangeHandle NodeColumns::haloExchangeStart( const Field& field, bool on_device ) const {
+    FieldSet fieldset;
+    fieldset.add( field );
+    return haloExchangeStart( fieldset, on_device );
+}
+
+void NodeColumns::adjointHaloExchange( const FieldSet& fieldset, bool on_device ) const {
     for ( idx_t f = 0; f < fieldset.size(); ++f ) {
         Field& field = const_cast<FieldSet&>( fieldset )[f];
         switch ( field.rank() ) {
             case 1:
-                dispatch_haloExchange<1>( field, halo_exchange(), on_device );
+                dispatch_adjointHaloExchange<1>( field, halo_exchange(), on_device );
                 break;
             case 2:
-                dispatch_haloExchange<2>( field, halo_exchange(), on_device );
+                dispatch_adjointHaloExchange<2>( field, halo_exchange(), on_device );
                 break;
             case 3:
-                dispatch_haloExchange<3>( field, halo_exchange(), on_device );
+                dispatch_adjointHaloExchange<3>( field, halo_exchange(), on_device );
                 break;
             case 4:
-                dispatch_haloExchange<4>( field, halo_exchange(), on_device );
+                dispatch_adjointHaloExchange<4>( field, halo_exchange(), on_device );
                 break;
             default:
                 throw_Exception( "Rank not supported", Here() );
@@ -388,11 +470,12 @@ void NodeColumns::haloExchange( const FieldSet& fieldset, bool on_device ) const
     }
 }
 
-void NodeColumns::haloExchange( const Field& field, bool on_device ) const {
+void NodeColumns::adjointHaloExchange( const Field& field, bool on_device ) const {
     FieldSet fieldset;
     fieldset.add( field );
-    haloExchange( fieldset, on_device );
+    adjointHaloExchange( fieldset, on_device );
 }
+
 const parallel::HaloExchange& NodeColumns::halo_exchange() const {
     if ( halo_exchange_ ) {
         return *halo_exchange_;
@@ -401,40 +484,34 @@ const parallel::HaloExchange& NodeColumns::halo_exchange() const {
     return *halo_exchange_;
 }
 
+const parallel::HaloExchange& NodeColumns::halo_exchange( idx_t halo ) const {
+    if ( halo >= halo_.size() ) {
+        return halo_exchange();
+    }
+    ATLAS_ASSERT( halo >= 0 );
+    auto& partial_halo_exchange = partial_halo_exchanges_[halo];
+    if ( !partial_halo_exchange ) {
+        partial_halo_exchange = NodeColumnsHaloExchangeCache::instance().get_or_create( mesh_, halo );
+    }
+    return *partial_halo_exchange;
+}
+
 void NodeColumns::gather( const FieldSet& local_fieldset, FieldSet& global_fieldset ) const {
     ATLAS_ASSERT( local_fieldset.size() == global_fieldset.size() );
 
     for ( idx_t f = 0; f < local_fieldset.size(); ++f ) {
-        const Field& loc      = local_fieldset[f];
-        Field& glb            = global_fieldset[f];
-        const idx_t nb_fields = 1;
-        idx_t root( 0 );
-        glb.metadata().get( "owner", root );
-
-        if ( loc.datatype() == array::DataType::kind<int>() ) {
-            parallel::Field<int const> loc_field( make_leveled_view<int>( loc ) );
-            parallel::Field<int> glb_field( make_leveled_view<int>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<long>() ) {
-            parallel::Field<long const> loc_field( make_leveled_view<long>( loc ) );
-            parallel::Field<long> glb_field( make_leveled_view<long>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<float>() ) {
-            parallel::Field<float const> loc_field( make_leveled_view<float>( loc ) );
-            parallel::Field<float> glb_field( make_leveled_view<float>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<double>() ) {
-            parallel::Field<double const> loc_field( make_leveled_view<double>( loc ) );
-            parallel::Field<double> glb_field( make_leveled_view<double>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else {
+        const array::DataType datatype = local_fieldset[f].datatype();
+        if ( datatype != array::DataType::kind<int>() && datatype != array::DataType::kind<long>() &&
+             datatype != array::DataType::kind<float>() && datatype != array::DataType::kind<double>() ) {
             throw_Exception( "datatype not supported", Here() );
         }
     }
+
+    // Fields with different owners are gathered concurrently, see GatherScatter::gather
+    gather_fieldset<int>( gather(), local_fieldset, global_fieldset );
+    gather_fieldset<long>( gather(), local_fieldset, global_fieldset );
+    gather_fieldset<float>( gather(), local_fieldset, global_fieldset );
+    gather_fieldset<double>( gather(), local_fieldset, global_fieldset );
 }
 
 void NodeColumns::gather( const Field& local, Field& global ) const {
@@ -638,10 +715,38 @@ void NodeColumns::haloExchange( const Field& field, bool on_device ) const {
     functionspace_->haloExchange( field, on_device );
 }
 
+void NodeColumns::haloExchange( const FieldSet& fieldset, const eckit::Configuration& config ) const {
+    functionspace_->haloExchange( fieldset, config );
+}
+
+void NodeColumns::haloExchange( const Field& field, const eckit::Configuration& config ) const {
+    functionspace_->haloExchange( field, config );
+}
+
+parallel::HaloExchangeHandle NodeColumns::haloExchangeStart( const FieldSet& fieldset, bool on_device ) const {
+    return functionspace_->haloExchangeStart( fieldset, on_device );
+}
+
+parallel::HaloExchangeHandle NodeColumns::haloExchangeStart( const Field& field, bool on_device ) const {
+    return functionspace_->haloExchangeStart( field, on_device );
+}
+
+void NodeColumns::adjointHaloExchange( const FieldSet& fieldset, bool on_device ) const {
+    functionspace_->adjointHaloExchange( fieldset, on_device );
+}
+
+void NodeColumns::adjointHaloExchange( const Field& field, bool on_device ) const {
+    functionspace_->adjointHaloExchange( field, on_device );
+}
+
 const parallel::HaloExchange& NodeColumns::halo_exchange() const {
     return functionspace_->halo_exchange();
 }
 
+const parallel::HaloExchange& NodeColumns::halo_exchange( idx_t halo ) const {
+    return functionspace_->halo_exchange( halo );
+}
+
 void NodeColumns::gather( const FieldSet& local, FieldSet& global ) const {
     functionspace_->gather( local, global );
 }
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <map>
+
 #include "atlas/functionspace/FunctionSpace.h"
 #include "atlas/functionspace/detail/FunctionSpaceImpl.h"
 #include "atlas/library/config.h"
@@ -84,10 +86,19 @@ public:
 
     void haloExchange( const FieldSet&, bool on_device = false ) const override;
     void haloExchange( const Field&, bool on_device = false ) const override;
+    void haloExchange( const FieldSet&, const eckit::Configuration& ) const override;
+    void haloExchange( const Field&, const eckit::Configuration& ) const override;
+    parallel::HaloExchangeHandle haloExchangeStart( const FieldSet&, bool on_device = false ) const override;
+    parallel::HaloExchangeHandle haloExchangeStart( const Field&, bool on_device = false ) const override;
+    void adjointHaloExchange( const FieldSet&, bool on_device = false ) const override;
+    void adjointHaloExchange( const Field&, bool on_device = false ) const override;
     const parallel::HaloExchange& halo_exchange() const;
 
-    void gather( const FieldSet&, FieldSet& ) const;
-    void gather( const Field&, Field& ) const;
+    /// @brief HaloExchange for the first given number of halo layers only
+    const parallel::HaloExchange& halo_exchange( idx_t halo ) const;
+
+    void gather( const FieldSet&, FieldSet& ) const override;
+    void gather( const Field&, Field& ) const override;
     const parallel::GatherScatter& gather() const;
 
     void scatter( const FieldSet&, FieldSet& ) const;
@@ -278,9 +289,12 @@ private:                  // data
 
     mutable util::ObjectHandle<parallel::GatherScatter> gather_scatter_;  // without ghost
     mutable util::ObjectHandle<parallel::HaloExchange> halo_exchange_;
+    mutable std::map<idx_t, util::ObjectHandle<parallel::HaloExchange>> partial_halo_exchanges_;
     mutable util::ObjectHandle<parallel::Checksum> checksum_;
 
 private:
+    parallel::HaloExchangeHandle start_halo_exchange( const FieldSet&, bool on_device, idx_t halo ) const;
+
     template <typename Value>
     struct FieldStatisticsT {
         FieldStatisticsT( const NodeColumns* );
@@ -474,7 +488,14 @@ public:
 
     void haloExchange( const FieldSet&, bool on_device = false ) const;
     void haloExchange( const Field&, bool on_device = false ) const;
+    void haloExchange( const FieldSet&, const eckit::Configuration& ) const;
+    void haloExchange( const Field&, const eckit::Configuration& ) const;
+    parallel::HaloExchangeHandle haloExchangeStart( const FieldSet&, bool on_device = false ) const;
+    parallel::HaloExchangeHandle haloExchangeStart( const Field&, bool on_device = false ) const;
+    void adjointHaloExchange( const FieldSet&, bool on_device = false ) const;
+    void adjointHaloExchange( const Field&, bool on_device = false ) const;
     const parallel::HaloExchange& halo_exchange() const;
+    const parallel::HaloExchange& halo_exchange( idx_t halo ) const;
 
     void gather( const FieldSet&, FieldSet& ) const;
     void gather( const Field&, Field& ) const;
@@ -92,28 +92,37 @@ public:
 #else
 class Spectral::Parallelisation {
 public:
-    Parallelisation( int truncation ) : truncation_( truncation ) {
-        // Assume serial!!!
-        nmyms_.resize( truncation_ + 1 );
-        nasm0_.resize( truncation_ + 1 );
-        nvalue_.resize( nb_spectral_coefficients() );
+    Parallelisation( int truncation ) : Parallelisation( truncation, 0, 1 ) {}
+
+    // Distribute the zonal wavenumbers over nb_parts in a zig-zag order (0,1,...,nb_parts-1,nb_parts-1,...,0,0,1,...),
+    // which balances the work as the number of total wavenumbers decreases with m.
+    Parallelisation( int truncation, int part, int nb_parts ) :
+        truncation_( truncation ),
+        distribution_( nb_parts > 1 ? "zigzag" : "serial" ) {
+        nasm0_.assign( truncation_ + 1, -1 );
         idx_t jc{0};
         for ( idx_t m = 0; m <= truncation_; ++m ) {
-            nmyms_[m] = m;
+            const int cycle = m % ( 2 * nb_parts );
+            if ( ( cycle < nb_parts ? cycle : 2 * nb_parts - 1 - cycle ) != part ) {
+                continue;
+            }
+            nmyms_.push_back( m );
             nasm0_[m] = jc + 1;  // Fortran index
             for ( idx_t n = m; n <= truncation_; ++n ) {
-                nvalue_[jc++] = n;
-                nvalue_[jc++] = n;
+                nvalue_.push_back( n );
+                nvalue_.push_back( n );
+                jc += 2;
             }
         }
         ATLAS_ASSERT( jc == nb_spectral_coefficients() );
     }
     int nb_spectral_coefficients_global() const { return ( truncation_ + 1 ) * ( truncation_ + 2 ); }
-    int nb_spectral_coefficients() const { return nb_spectral_coefficients_global(); }
+    int nb_spectral_coefficients() const { return static_cast<int>( nvalue_.size() ); }
     int truncation_;
-    std::string distribution() const { return "serial"; }
+    std::string distribution_;
+    std::string distribution() const { return distribution_; }
 
-    int nump() const { return truncation_ + 1; }
+    int nump() const { return static_cast<int>( nmyms_.size() ); }
 
     array::LocalView<int, 1, array::Intent::ReadOnly> nmyms() const {
         return array::LocalView<int, 1, array::Intent::ReadOnly>( nmyms_.data(), array::make_shape( nump() ) );
@@ -173,7 +182,16 @@ Spectral::Spectral( const eckit::Configuration& config ) :
 Spectral::Spectral( const int truncation, const eckit::Configuration& config ) :
     nb_levels_( 0 ),
     truncation_( truncation ),
-    parallelisation_( new Parallelisation( truncation_ ) ) {
+    parallelisation_( [&]() -> Parallelisation* {
+#if !ATLAS_HAVE_TRANS
+        // with the trans library the zonal wavenumbers are always distributed
+        if ( config.getBool( "distributed", false ) ) {
+            return new Parallelisation( truncation_, static_cast<int>( mpi::comm().rank() ),
+                                        static_cast<int>( mpi::comm().size() ) );
+        }
+#endif
+        return new Parallelisation( truncation_ );
+    }() ) {
     config.get( "levels", nb_levels_ );
 }
 
@@ -471,6 +489,10 @@ int Spectral::truncation() const {
     return functionspace_->truncation();
 }
 
+array::LocalView<int, 1, array::Intent::ReadOnly> Spectral::zonal_wavenumbers() const {
+    return functionspace_->zonal_wavenumbers();
+}
+
 void Spectral::gather( const FieldSet& local_fieldset, FieldSet& global_fieldset ) const {
     functionspace_->gather( local_fieldset, global_fieldset );
 }
@@ -61,6 +61,8 @@ class Spectral : public FunctionSpaceImpl {
 public:
     Spectral( const eckit::Configuration& );
 
+    /// Without the trans library the spectral data is serial, unless config option "distributed" is true,
+    /// in which case the zonal wavenumbers are distributed over the MPI tasks.
     Spectral( const int truncation, const eckit::Configuration& = util::NoConfig() );
 
     Spectral( const trans::Trans&, const eckit::Configuration& = util::NoConfig() );
@@ -76,8 +78,8 @@ public:
     virtual Field createField( const eckit::Configuration& ) const override;
     virtual Field createField( const Field&, const eckit::Configuration& ) const override;
 
-    void gather( const FieldSet&, FieldSet& ) const;
-    void gather( const Field&, Field& ) const;
+    void gather( const FieldSet&, FieldSet& ) const override;
+    void gather( const Field&, Field& ) const override;
 
     void scatter( const FieldSet&, FieldSet& ) const;
     void scatter( const Field&, Field& ) const;
@@ -238,6 +240,7 @@ public:
     idx_t nb_spectral_coefficients() const;
     idx_t nb_spectral_coefficients_global() const;
     int truncation() const;
+    array::LocalView<int, 1, array::Intent::ReadOnly> zonal_wavenumbers() const;  // zero-based
     idx_t levels() const { return functionspace_->levels(); }
 
     template <typename Functor>
@@ -10,6 +10,8 @@
 
 #include "atlas/functionspace/StructuredColumns.h"
 
+#include <algorithm>
+#include <functional>
 #include <iomanip>
 #include <mutex>
 #include <sstream>
@@ -20,6 +22,7 @@
 #include "atlas/array/Array.h"
 #include "atlas/array/MakeView.h"
 #include "atlas/field/FieldSet.h"
+#include "atlas/functionspace/detail/GatherFieldSet.h"
 #include "atlas/grid/Distribution.h"
 #include "atlas/grid/Partitioner.h"
 #include "atlas/grid/StructuredGrid.h"
@@ -44,27 +47,6 @@ namespace detail {
 
 namespace {
 
-template <typename T>
-array::LocalView<T, 3> make_leveled_view( const Field& field ) {
-    using namespace array;
-    if ( field.levels() ) {
-        if ( field.variables() ) {
-            return make_view<T, 3>( field ).slice( Range::all(), Range::all(), Range::all() );
-        }
-        else {
-            return make_view<T, 2>( field ).slice( Range::all(), Range::all(), Range::dummy() );
-        }
-    }
-    else {
-        if ( field.variables() ) {
-            return make_view<T, 2>( field ).slice( Range::all(), Range::dummy(), Range::all() );
-        }
-        else {
-            return make_view<T, 1>( field ).slice( Range::all(), Range::dummy(), Range::dummy() );
-        }
-    }
-}
-
 template <typename T>
 std::string checksum_3d_field( const parallel::Checksum& checksum, const Field& field ) {
     array::LocalView<T, 3> values = make_leveled_view<T>( field );
@@ -96,16 +78,24 @@ public:
         return inst;
     }
     util::ObjectHandle<value_type> get_or_create( const detail::StructuredColumns& funcspace ) {
-        creator_type creator = std::bind( &StructuredColumnsHaloExchangeCache::create, &funcspace );
-        return Base::get_or_create( key( *funcspace.grid().get(), funcspace.halo() ),
+        return get_or_create( funcspace, funcspace.halo() );
+    }
+    /// HaloExchange of the first given number of halo layers only
+    util::ObjectHandle<value_type> get_or_create( const detail::StructuredColumns& funcspace, idx_t depth ) {
+        creator_type creator = std::bind( &StructuredColumnsHaloExchangeCache::create, &funcspace, depth );
+        return Base::get_or_create( key( *funcspace.grid().get(), funcspace.halo(), depth ),
                                     remove_key( *funcspace.grid().get() ), creator );
     }
     void onGridDestruction( grid::detail::grid::Grid& grid ) override { remove( remove_key( grid ) ); }
 
 private:
-    static Base::key_type key( const grid::detail::grid::Grid& grid, idx_t halo ) {
+    static Base::key_type key( const grid::detail::grid::Grid& grid, idx_t halo, idx_t depth ) {
         std::ostringstream key;
-        key << "grid[address=" << &grid << ",halo=" << halo << "]";
+        key << "grid[address=" << &grid << ",halo=" << halo;
+        if ( depth < halo ) {
+            key << ",depth=" << depth;
+        }
+        key << "]";
         return key.str();
     }
 
@@ -115,14 +105,33 @@ private:
         return key.str();
     }
 
-    static value_type* create( const detail::StructuredColumns* funcspace ) {
+    static value_type* create( const detail::StructuredColumns* funcspace, idx_t depth ) {
         funcspace->grid().get()->attachObserver( instance() );
 
-        value_type* value = new value_type();
+        value_type* value = new value_type( "StructuredColumns[halo=" +
+                                             std::to_string( std::min( depth, funcspace->halo() ) ) + "]" );
 
-        value->setup( array::make_view<int, 1>( funcspace->partition() ).data(),
-                      array::make_view<idx_t, 1>( funcspace->remote_index() ).data(), REMOTE_IDX_BASE,
-                      funcspace->sizeHalo() );
+        if ( depth >= funcspace->halo() ) {
+            value->setup( array::make_view<int, 1>( funcspace->partition() ).data(),
+                          array::make_view<idx_t, 1>( funcspace->remote_index() ).data(), REMOTE_IDX_BASE,
+                          funcspace->sizeHalo() );
+            return value;
+        }
+
+        // Points beyond the requested depth are presented as owned, so that they are not exchanged
+        const idx_t size = funcspace->sizeHalo();
+        const int mypart = static_cast<int>( mpi::comm().rank() );
+        auto partition   = array::make_view<int, 1>( funcspace->partition() );
+        auto remote_idx  = array::make_view<idx_t, 1>( funcspace->remote_index() );
+        auto halo_level  = array::make_view<int, 1>( funcspace->halo_level() );
+        std::vector<int> part( size );
+        std::vector<idx_t> ridx( size );
+        for ( idx_t n = 0; n < size; ++n ) {
+            const bool exchanged = halo_level( n ) <= depth;
+            part[n]              = exchanged ? partition( n ) : mypart;
+            ridx[n]              = exchanged ? remote_idx( n ) : n + REMOTE_IDX_BASE;
+        }
+        value->setup( part.data(), ridx.data(), REMOTE_IDX_BASE, size );
         return value;
     }
     ~StructuredColumnsHaloExchangeCache() override = default;
@@ -155,7 +164,7 @@ private:
     static value_type* create( const detail::StructuredColumns* funcspace ) {
         funcspace->grid().get()->attachObserver( instance() );
 
-        value_type* value = new value_type();
+        value_type* value = new value_type( "StructuredColumns" );
 
         value->setup( array::make_view<int, 1>( funcspace->partition() ).data(),
                       array::make_view<idx_t, 1>( funcspace->remote_index() ).data(), REMOTE_IDX_BASE,
@@ -233,6 +242,18 @@ const parallel::HaloExchange& StructuredColumns::halo_exchange() const {
     return *halo_exchange_;
 }
 
+const parallel::HaloExchange& StructuredColumns::halo_exchange( idx_t halo ) const {
+    if ( halo >= halo_ ) {
+        return halo_exchange();
+    }
+    ATLAS_ASSERT( halo >= 0 );
+    auto& partial_halo_exchange = partial_halo_exchanges_[halo];
+    if ( !partial_halo_exchange ) {
+        partial_halo_exchange = StructuredColumnsHaloExchangeCache::instance().get_or_create( *this, halo );
+    }
+    return *partial_halo_exchange;
+}
+
 void StructuredColumns::set_field_metadata( const eckit::Configuration& config, Field& field ) const {
     field.set_functionspace( this );
 
@@ -459,36 +480,18 @@ void StructuredColumns::gather( const FieldSet& local_fieldset, FieldSet& global
     ATLAS_ASSERT( local_fieldset.size() == global_fieldset.size() );
 
     for ( idx_t f = 0; f < local_fieldset.size(); ++f ) {
-        const Field& loc      = local_fieldset[f];
-        Field& glb            = global_fieldset[f];
-        const idx_t nb_fields = 1;
-        idx_t root( 0 );
-        glb.metadata().get( "owner", root );
-
-        if ( loc.datatype() == array::DataType::kind<int>() ) {
-            parallel::Field<int const> loc_field( make_leveled_view<int>( loc ) );
-            parallel::Field<int> glb_field( make_leveled_view<int>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<long>() ) {
-            parallel::Field<long const> loc_field( make_leveled_view<long>( loc ) );
-            parallel::Field<long> glb_field( make_leveled_view<long>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<float>() ) {
-            parallel::Field<float const> loc_field( make_leveled_view<float>( loc ) );
-            parallel::Field<float> glb_field( make_leveled_view<float>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<double>() ) {
-            parallel::Field<double const> loc_field( make_leveled_view<double>( loc ) );
-            parallel::Field<double> glb_field( make_leveled_view<double>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else {
+        const array::DataType datatype = local_fieldset[f].datatype();
+        if ( datatype != array::DataType::kind<int>() && datatype != array::DataType::kind<long>() &&
+             datatype != array::DataType::kind<float>() && datatype != array::DataType::kind<double>() ) {
             throw_Exception( "datatype not supported", Here() );
         }
     }
+
+    // Fields with different owners are gathered concurrently, see GatherScatter::gather
+    gather_fieldset<int>( gather(), local_fieldset, global_fieldset );
+    gather_fieldset<long>( gather(), local_fieldset, global_fieldset );
+    gather_fieldset<float>( gather(), local_fieldset, global_fieldset );
+    gather_fieldset<double>( gather(), local_fieldset, global_fieldset );
 }
 // ----------------------------------------------------------------------------
 
@@ -596,7 +599,7 @@ namespace {
 
 template <int RANK>
 struct FixupHaloForVectors {
-    FixupHaloForVectors( const StructuredColumns& ) {}
+    FixupHaloForVectors( const StructuredColumns&, idx_t ) {}
     template <typename DATATYPE>
     void apply( Field& field ) {
         std::string type = field.metadata().getString( "type", "scalar" );
@@ -610,23 +613,31 @@ template <>
 struct FixupHaloForVectors<2> {
     static constexpr int RANK = 2;
     const StructuredColumns& fs;
-    FixupHaloForVectors( const StructuredColumns& _fs ) : fs( _fs ) {}
+    const idx_t depth;  // Only points up to this halo depth were exchanged
+    FixupHaloForVectors( const StructuredColumns& _fs, idx_t _depth ) : fs( _fs ), depth( _depth ) {}
 
     template <typename DATATYPE>
     void apply( Field& field ) {
         std::string type = field.metadata().getString( "type", "scalar" );
         if ( type == "vector" ) {
-            auto array = array::make_view<DATATYPE, RANK>( field );
+            auto array      = array::make_view<DATATYPE, RANK>( field );
+            auto halo_level = array::make_view<int, 1>( fs.halo_level() );
             for ( idx_t j = fs.j_begin_halo(); j < 0; ++j ) {
                 for ( idx_t i = fs.i_begin_halo( j ); i < fs.i_end_halo( j ); ++i ) {
-                    idx_t n        = fs.index( i, j );
+                    idx_t n = fs.index( i, j );
+                    if ( halo_level( n ) > depth ) {
+                        continue;
+                    }
                     array( n, XX ) = -array( n, XX );
                     array( n, YY ) = -array( n, YY );
                 }
             }
             for ( idx_t j = fs.grid().ny(); j < fs.j_end_halo(); ++j ) {
                 for ( idx_t i = fs.i_begin_halo( j ); i < fs.i_end_halo( j ); ++i ) {
-                    idx_t n        = fs.index( i, j );
+                    idx_t n = fs.index( i, j );
+                    if ( halo_level( n ) > depth ) {
+                        continue;
+                    }
                     array( n, XX ) = -array( n, XX );
                     array( n, YY ) = -array( n, YY );
                 }
@@ -639,16 +650,21 @@ template <>
 struct FixupHaloForVectors<3> {
     static constexpr int RANK = 3;
     const StructuredColumns& fs;
-    FixupHaloForVectors( const StructuredColumns& _fs ) : fs( _fs ) {}
+    const idx_t depth;  // Only points up to this halo depth were exchanged
+    FixupHaloForVectors( const StructuredColumns& _fs, idx_t _depth ) : fs( _fs ), depth( _depth ) {}
 
     template <typename DATATYPE>
     void apply( Field& field ) {
         std::string type = field.metadata().getString( "type", "scalar" );
         if ( type == "vector" ) {
-            auto array = array::make_view<DATATYPE, RANK>( field );
+            auto array      = array::make_view<DATATYPE, RANK>( field );
+            auto halo_level = array::make_view<int, 1>( fs.halo_level() );
             for ( idx_t j = fs.j_begin_halo(); j < 0; ++j ) {
                 for ( idx_t i = fs.i_begin_halo( j ); i < fs.i_end_halo( j ); ++i ) {
                     idx_t n = fs.index( i, j );
+                    if ( halo_level( n ) > depth ) {
+                        continue;
+                    }
                     for ( idx_t k = fs.k_begin(); k < fs.k_end(); ++k ) {
                         array( n, k, XX ) = -array( n, k, XX );
                         array( n, k, YY ) = -array( n, k, YY );
@@ -658,6 +674,9 @@ struct FixupHaloForVectors<3> {
             for ( idx_t j = fs.grid().ny(); j < fs.j_end_halo(); ++j ) {
                 for ( idx_t i = fs.i_begin_halo( j ); i < fs.i_end_halo( j ); ++i ) {
                     idx_t n = fs.index( i, j );
+                    if ( halo_level( n ) > depth ) {
+                        continue;
+                    }
                     for ( idx_t k = fs.k_begin(); k < fs.k_end(); ++k ) {
                         array( n, k, XX ) = -array( n, k, XX );
                         array( n, k, YY ) = -array( n, k, YY );
@@ -669,58 +688,218 @@ struct FixupHaloForVectors<3> {
 };
 
 
+template <int RANK, typename DATATYPE>
+std::function<void()> fixup_halos_for_vectors( Field& field, const StructuredColumns& fs, idx_t depth ) {
+    const StructuredColumns* funcspace = &fs;
+    return [field, funcspace, depth]() mutable {
+        FixupHaloForVectors<RANK> fixup_halos( *funcspace, depth );
+        fixup_halos.template apply<DATATYPE>( field );
+    };
+}
+
+// Only vector fields need their halo fixed up after an exchange
+bool needs_fixupHalos( const Field& field ) {
+    return field.metadata().getString( "type", "scalar" ) == "vector";
+}
+
+template <int RANK>
+std::function<void()> dispatch_fixupHalos( Field& field, const StructuredColumns& fs, idx_t depth ) {
+    if ( field.datatype() == array::DataType::kind<int>() ) {
+        return fixup_halos_for_vectors<RANK, int>( field, fs, depth );
+    }
+    else if ( field.datatype() == array::DataType::kind<long>() ) {
+        return fixup_halos_for_vectors<RANK, long>( field, fs, depth );
+    }
+    else if ( field.datatype() == array::DataType::kind<float>() ) {
+        return fixup_halos_for_vectors<RANK, float>( field, fs, depth );
+    }
+    else if ( field.datatype() == array::DataType::kind<double>() ) {
+        return fixup_halos_for_vectors<RANK, double>( field, fs, depth );
+    }
+    throw_Exception( "datatype not supported", Here() );
+}
+
+std::function<void()> dispatch_fixupHalos( Field& field, const StructuredColumns& fs, idx_t depth ) {
+    switch ( field.rank() ) {
+        case 1:
+            return dispatch_fixupHalos<1>( field, fs, depth );
+        case 2:
+            return dispatch_fixupHalos<2>( field, fs, depth );
+        case 3:
+            return dispatch_fixupHalos<3>( field, fs, depth );
+        case 4:
+            return dispatch_fixupHalos<4>( field, fs, depth );
+        default:
+            throw_Exception( "Rank not supported", Here() );
+    }
+}
+
+template <int RANK>
+parallel::HaloExchangeHandle dispatch_haloExchangeStart( Field& field, const parallel::HaloExchange& halo_exchange,
+                                                         const StructuredColumns& fs, idx_t depth ) {
+    parallel::HaloExchangeHandle handle;
+    if ( field.datatype() == array::DataType::kind<int>() ) {
+        handle = halo_exchange.template start<int, RANK>( field.array(), false );
+    }
+    else if ( field.datatype() == array::DataType::kind<long>() ) {
+        handle = halo_exchange.template start<long, RANK>( field.array(), false );
+    }
+    else if ( field.datatype() == array::DataType::kind<float>() ) {
+        handle = halo_exchange.template start<float, RANK>( field.array(), false );
+    }
+    else if ( field.datatype() == array::DataType::kind<double>() ) {
+        const auto precision =
+            field.single_precision_halo() ? parallel::WirePrecision::Single : parallel::WirePrecision::Native;
+        handle = halo_exchange.template start<double, RANK>( field.array(), false, precision );
+    }
+    else {
+        throw_Exception( "datatype not supported", Here() );
+    }
+    if ( needs_fixupHalos( field ) ) {
+        handle.append( dispatch_fixupHalos<RANK>( field, fs, depth ) );
+    }
+    return handle;
+}
+
 template <int RANK>
-void dispatch_haloExchange( Field& field, const parallel::HaloExchange& halo_exchange, const StructuredColumns& fs ) {
-    FixupHaloForVectors<RANK> fixup_halos( fs );
+void dispatch_adjointHaloExchange( Field& field, const parallel::HaloExchange& halo_exchange,
+                                   const StructuredColumns& fs, bool on_device ) {
+    // The vector fixup only changes signs, so it is its own adjoint, applied before sending back
+    if ( needs_fixupHalos( field ) ) {
+        dispatch_fixupHalos<RANK>( field, fs, fs.halo() )();
+    }
     if ( field.datatype() == array::DataType::kind<int>() ) {
-        halo_exchange.template execute<int, RANK>( field.array(), false );
-        fixup_halos.template apply<int>( field );
+        halo_exchange.template execute_adjoint<int, RANK>( field.array(), on_device );
     }
     else if ( field.datatype() == array::DataType::kind<long>() ) {
-        halo_exchange.template execute<long, RANK>( field.array(), false );
-        fixup_halos.template apply<long>( field );
+        halo_exchange.template execute_adjoint<long, RANK>( field.array(), on_device );
     }
     else if ( field.datatype() == array::DataType::kind<float>() ) {
-        halo_exchange.template execute<float, RANK>( field.array(), false );
-        fixup_halos.template apply<float>( field );
+        halo_exchange.template execute_adjoint<float, RANK>( field.array(), on_device );
     }
     else if ( field.datatype() == array::DataType::kind<double>() ) {
-        halo_exchange.template execute<double, RANK>( field.array(), false );
-        fixup_halos.template apply<double>( field );
+        halo_exchange.template execute_adjoint<double, RANK>( field.array(), on_device );
     }
     else {
         throw_Exception( "datatype not supported", Here() );
     }
-    field.set_dirty( false );
+    field.set_dirty( true );
 }
 }  // namespace
 
-void StructuredColumns::haloExchange( const FieldSet& fieldset, bool ) const {
+void StructuredColumns::haloExchange( const FieldSet& fieldset, bool on_device ) const {
+    haloExchangeStart( fieldset, on_device ).wait();
+}
+
+void StructuredColumns::haloExchange( const Field& field, bool on_device ) const {
+    FieldSet fieldset;
+    fieldset.add( field );
+    haloExchange( fieldset, on_device );
+}
+
+void StructuredColumns::haloExchange( const FieldSet& fieldset, const eckit::Configuration& config ) const {
+    start_halo_exchange( fieldset, config.getInt( "halo", halo_ ) ).wait();
+}
+
+void StructuredColumns::haloExchange( const Field& field, const eckit::Configuration& config ) const {
+    FieldSet fieldset;
+    fieldset.add( field );
+    haloExchange( fieldset, config );
+}
+
+parallel::HaloExchangeHandle StructuredColumns::haloExchangeStart( const FieldSet& fieldset, bool ) const {
+    return start_halo_exchange( fieldset, halo_ );
+}
+
+parallel::HaloExchangeHandle StructuredColumns::start_halo_exchange( const FieldSet& fieldset, idx_t halo ) const {
+    const parallel::HaloExchange& halo_exchange = this->halo_exchange( halo );
+
+    // Only a complete exchange leaves the fields clean, once it has been waited for
+    const bool complete = halo >= halo_;
+
+    parallel::HaloExchangeHandle handle;
+    if ( fieldset.size() > 1 ) {
+        // Fused exchange: a single message per neighbouring task for all fields of the same wire precision
+        std::vector<array::Array*> arrays;
+        std::vector<array::Array*> single_precision_arrays;
+        for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+            Field& field = const_cast<FieldSet&>( fieldset )[f];
+            ( field.single_precision_halo() ? single_precision_arrays : arrays ).emplace_back( &field.array() );
+        }
+        if ( !arrays.empty() ) {
+            handle.append( halo_exchange.start( arrays ) );
+        }
+        if ( !single_precision_arrays.empty() ) {
+            handle.append( halo_exchange.start( single_precision_arrays, parallel::WirePrecision::Single ) );
+        }
+        for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+            Field& field = const_cast<FieldSet&>( fieldset )[f];
+            if ( needs_fixupHalos( field ) ) {
+                handle.append( dispatch_fixupHalos( field, *this, halo ) );
+            }
+        }
+        if ( complete ) {
+            handle.append( [fieldset]() { fieldset.set_dirty( false ); } );
+        }
+        return handle;
+    }
     for ( idx_t f = 0; f < fieldset.size(); ++f ) {
         Field& field = const_cast<FieldSet&>( fieldset )[f];
         switch ( field.rank() ) {
             case 1:
-                dispatch_haloExchange<1>( field, halo_exchange(), *this );
+                handle.append( dispatch_haloExchangeStart<1>( field, halo_exchange, *this, halo ) );
                 break;
             case 2:
-                dispatch_haloExchange<2>( field, halo_exchange(), *this );
+                handle.append( dispatch_haloExchangeStart<2>( field, halo_exchange, *this, halo ) );
                 break;
             case 3:
-                dispatch_haloExchange<3>( field, halo_exchange(), *this );
+                handle.append( dispatch_haloExchangeStart<3>( field, halo_exchange, *this, halo ) );
                 break;
             case 4:
-                dispatch_haloExchange<4>( field, halo_exchange(), *this );
+                handle.append( dispatch_haloExchangeStart<4>( field, halo_exchange, *this, halo ) );
                 break;
             default:
                 throw_Exception( "Rank not supported", Here() );
         }
     }
+    if ( complete ) {
+        handle.append( [fieldset]() { fieldset.set_dirty( false ); } );
+    }
+    return handle;
 }
 
-void StructuredColumns::haloExchange( const Field& field, bool ) const {
+parallel::HaloExchangeHandle StructuredColumns::haloExchangeStart( const Field& field, bool on_device ) const {
     FieldSet fieldset;
     fieldset.add( field );
-    haloExchange( fieldset );
+    return haloExchangeStart( fieldset, on_device );
+}
+
+void StructuredColumns::adjointHaloExchange( const FieldSet& fieldset, bool on_device ) const {
+    for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+        Field& field = const_cast<FieldSet&>( fieldset )[f];
+        switch ( field.rank() ) {
+            case 1:
+                dispatch_adjointHaloExchange<1>( field, halo_exchange(), *this, on_device );
+                break;
+            case 2:
+                dispatch_adjointHaloExchange<2>( field, halo_exchange(), *this, on_device );
+                break;
+            case 3:
+                dispatch_adjointHaloExchange<3>( field, halo_exchange(), *this, on_device );
+                break;
+            case 4:
+                dispatch_adjointHaloExchange<4>( field, halo_exchange(), *this, on_device );
+                break;
+            default:
+                throw_Exception( "Rank not supported", Here() );
+        }
+    }
+}
+
+void StructuredColumns::adjointHaloExchange( const Field& field, bool on_device ) const {
+    FieldSet fieldset;
+    fieldset.add( field );
+    adjointHaloExchange( fieldset, on_device );
 }
 
 size_t StructuredColumns::footprint() const {
@@ -744,6 +923,9 @@ size_t StructuredColumns::footprint() const {
     if ( field_index_j_ ) {
         size += field_index_j_.footprint();
     }
+    if ( field_halo_level_ ) {
+        size += field_halo_level_.footprint();
+    }
     return size;
 }
 
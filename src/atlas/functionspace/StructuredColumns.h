@@ -11,6 +11,7 @@
 
 #include <array>
 #include <functional>
+#include <map>
 #include <type_traits>
 
 #include "atlas/array/DataType.h"
@@ -87,14 +88,20 @@ public:
 
     virtual Field createField( const Field&, const eckit::Configuration& ) const override;
 
-    void gather( const FieldSet&, FieldSet& ) const;
-    void gather( const Field&, Field& ) const;
+    void gather( const FieldSet&, FieldSet& ) const override;
+    void gather( const Field&, Field& ) const override;
 
     void scatter( const FieldSet&, FieldSet& ) const;
     void scatter( const Field&, Field& ) const;
 
     virtual void haloExchange( const FieldSet&, bool on_device = false ) const override;
     virtual void haloExchange( const Field&, bool on_device = false ) const override;
+    virtual void haloExchange( const FieldSet&, const eckit::Configuration& ) const override;
+    virtual void haloExchange( const Field&, const eckit::Configuration& ) const override;
+    virtual parallel::HaloExchangeHandle haloExchangeStart( const FieldSet&, bool on_device = false ) const override;
+    virtual parallel::HaloExchangeHandle haloExchangeStart( const Field&, bool on_device = false ) const override;
+    virtual void adjointHaloExchange( const FieldSet&, bool on_device = false ) const override;
+    virtual void adjointHaloExchange( const Field&, bool on_device = false ) const override;
 
     idx_t sizeOwned() const { return size_owned_; }
     idx_t sizeHalo() const { return size_halo_; }
@@ -146,6 +153,9 @@ public:
     Field index_j() const { return field_index_j_; }
     Field ghost() const { return field_ghost_; }
 
+    /// @brief Halo layer each point belongs to: 0 for owned points, 1 to halo() for halo points
+    Field halo_level() const { return field_halo_level_; }
+
     void compute_xy( idx_t i, idx_t j, PointXY& xy ) const;
     PointXY compute_xy( idx_t i, idx_t j ) const {
         PointXY xy;
@@ -180,6 +190,9 @@ private:  // methods
     const parallel::GatherScatter& scatter() const;
     const parallel::Checksum& checksum() const;
     const parallel::HaloExchange& halo_exchange() const;
+    const parallel::HaloExchange& halo_exchange( idx_t halo ) const;
+
+    parallel::HaloExchangeHandle start_halo_exchange( const FieldSet&, idx_t halo ) const;
 
     void create_remote_index() const;
 
@@ -197,6 +210,7 @@ private:  // data
     mutable util::ObjectHandle<parallel::GatherScatter> gather_scatter_;
     mutable util::ObjectHandle<parallel::Checksum> checksum_;
     mutable util::ObjectHandle<parallel::HaloExchange> halo_exchange_;
+    mutable std::map<idx_t, util::ObjectHandle<parallel::HaloExchange>> partial_halo_exchanges_;
 
     Field field_xy_;
     Field field_partition_;
@@ -205,6 +219,7 @@ private:  // data
     Field field_index_i_;
     Field field_index_j_;
     Field field_ghost_;
+    Field field_halo_level_;
 
     class Map2to1 {
     public:
@@ -370,6 +385,7 @@ public:
     Field index_i() const { return functionspace_->index_i(); }
     Field index_j() const { return functionspace_->index_j(); }
     Field ghost() const { return functionspace_->ghost(); }
+    Field halo_level() const { return functionspace_->halo_level(); }
 
     void compute_xy( idx_t i, idx_t j, PointXY& xy ) const { return functionspace_->compute_xy( i, j, xy ); }
     PointXY compute_xy( idx_t i, idx_t j ) const { return functionspace_->compute_xy( i, j ); }
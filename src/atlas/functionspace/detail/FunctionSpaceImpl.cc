@@ -37,6 +37,40 @@ void FunctionSpaceImpl::haloExchange( const Field&, bool ) const {
     ATLAS_NOTIMPLEMENTED;
 }
 
+void FunctionSpaceImpl::haloExchange( const FieldSet& fieldset, const eckit::Configuration& config ) const {
+    haloExchange( fieldset, config.getBool( "on_device", false ) );
+}
+
+void FunctionSpaceImpl::haloExchange( const Field& field, const eckit::Configuration& config ) const {
+    haloExchange( field, config.getBool( "on_device", false ) );
+}
+
+parallel::HaloExchangeHandle FunctionSpaceImpl::haloExchangeStart( const FieldSet& fieldset, bool on_device ) const {
+    haloExchange( fieldset, on_device );
+    return parallel::HaloExchangeHandle();
+}
+
+parallel::HaloExchangeHandle FunctionSpaceImpl::haloExchangeStart( const Field& field, bool on_device ) const {
+    haloExchange( field, on_device );
+    return parallel::HaloExchangeHandle();
+}
+
+void FunctionSpaceImpl::adjointHaloExchange( const FieldSet&, bool ) const {
+    ATLAS_NOTIMPLEMENTED;
+}
+
+void FunctionSpaceImpl::adjointHaloExchange( const Field&, bool ) const {
+    ATLAS_NOTIMPLEMENTED;
+}
+
+void FunctionSpaceImpl::gather( const FieldSet&, FieldSet& ) const {
+    ATLAS_NOTIMPLEMENTED;
+}
+
+void FunctionSpaceImpl::gather( const Field&, Field& ) const {
+    ATLAS_NOTIMPLEMENTED;
+}
+
 Field NoFunctionSpace::createField( const eckit::Configuration& ) const {
     ATLAS_NOTIMPLEMENTED;
 }
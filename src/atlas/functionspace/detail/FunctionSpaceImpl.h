@@ -15,6 +15,7 @@
 #include "atlas/util/Object.h"
 
 #include "atlas/library/config.h"
+#include "atlas/parallel/HaloExchangeHandle.h"
 
 namespace eckit {
 class Configuration;
@@ -89,6 +90,28 @@ public:
     virtual void haloExchange( const FieldSet&, bool /*on_device*/ = false ) const;
     virtual void haloExchange( const Field&, bool /* on_device*/ = false ) const;
 
+    /// @brief Halo exchange with options: "halo" (depth, e.g. option::halo(1) to only exchange
+    /// the first halo layer), and "on_device" (bool)
+    /// @note  Default implementation exchanges the full halo
+    virtual void haloExchange( const FieldSet&, const eckit::Configuration& ) const;
+    virtual void haloExchange( const Field&, const eckit::Configuration& ) const;
+
+    /// @brief Start a non-blocking halo exchange, completed by the returned handle's wait()
+    /// @note  Default implementation performs a blocking haloExchange and returns an inactive handle
+    virtual parallel::HaloExchangeHandle haloExchangeStart( const FieldSet&, bool on_device = false ) const;
+    virtual parallel::HaloExchangeHandle haloExchangeStart( const Field&, bool on_device = false ) const;
+
+    /// @brief Adjoint of haloExchange: halo values are added to the values they are copies of,
+    /// after which the halo is zero and the fields are marked dirty
+    virtual void adjointHaloExchange( const FieldSet&, bool /*on_device*/ = false ) const;
+    virtual void adjointHaloExchange( const Field&, bool /*on_device*/ = false ) const;
+
+    /// @brief Gather local fields into global fields, each on the task given by its "owner" metadata
+    /// @note  Fields with different owners may be gathered concurrently, so that output can be
+    ///        spread round-robin over several tasks, see option::global(owner)
+    virtual void gather( const FieldSet&, FieldSet& ) const;
+    virtual void gather( const Field&, Field& ) const;
+
     virtual idx_t size() const = 0;
 
 private:
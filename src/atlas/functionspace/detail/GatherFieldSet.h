@@ -0,0 +1,73 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/parallel/GatherScatter.h"
+#include "atlas/util/Metadata.h"
+
+namespace atlas {
+namespace functionspace {
+namespace detail {
+
+// Gather helpers shared by the column function spaces
+
+/// View of a field as (points, levels, variables), with dummy dimensions for missing levels or variables
+template <typename T>
+array::LocalView<T, 3> make_leveled_view( const Field& field ) {
+    using namespace array;
+    if ( field.levels() ) {
+        if ( field.variables() ) {
+            return make_view<T, 3>( field ).slice( Range::all(), Range::all(), Range::all() );
+        }
+        else {
+            return make_view<T, 2>( field ).slice( Range::all(), Range::all(), Range::dummy() );
+        }
+    }
+    else {
+        if ( field.variables() ) {
+            return make_view<T, 2>( field ).slice( Range::all(), Range::dummy(), Range::all() );
+        }
+        else {
+            return make_view<T, 1>( field ).slice( Range::all(), Range::dummy(), Range::dummy() );
+        }
+    }
+}
+
+/// Gather all fields of datatype T at once, each to the task given by the "owner" of its global field
+template <typename T>
+void gather_fieldset( const parallel::GatherScatter& gather_scatter, const FieldSet& local_fieldset,
+                      FieldSet& global_fieldset ) {
+    std::vector<parallel::Field<T const>> loc_fields;
+    std::vector<parallel::Field<T>> glb_fields;
+    std::vector<idx_t> roots;
+    for ( idx_t f = 0; f < local_fieldset.size(); ++f ) {
+        const Field& loc = local_fieldset[f];
+        Field& glb       = global_fieldset[f];
+        if ( loc.datatype() != array::DataType::kind<T>() ) {
+            continue;
+        }
+        idx_t root( 0 );
+        glb.metadata().get( "owner", root );
+        loc_fields.push_back( parallel::Field<T const>( make_leveled_view<T>( loc ) ) );
+        glb_fields.push_back( parallel::Field<T>( make_leveled_view<T>( glb ) ) );
+        roots.push_back( root );
+    }
+    gather_scatter.gather( loc_fields.data(), glb_fields.data(), idx_t( loc_fields.size() ), roots );
+}
+
+}  // namespace detail
+}  // namespace functionspace
+}  // namespace atlas
@@ -10,6 +10,7 @@
 
 #include "atlas/functionspace/StructuredColumns.h"
 
+#include <cstdlib>
 #include <functional>
 #include <iomanip>
 #include <sstream>
@@ -210,6 +211,10 @@ void StructuredColumns::setup( const grid::Distribution& distribution, const eck
 
     GridPointSet gridpoints;
 
+    // Bounds for every halo depth up to halo, to find the halo layer each point belongs to
+    std::vector<IndexRange> i_begin_halo_depth( halo + 1 );
+    std::vector<IndexRange> i_end_halo_depth( halo + 1 );
+
     ATLAS_TRACE_SCOPE( "Compute mapping ..." ) {
         idx_t imin = std::numeric_limits<idx_t>::max();
         idx_t imax = -std::numeric_limits<idx_t>::max();
@@ -221,6 +226,14 @@ void StructuredColumns::setup( const grid::Distribution& distribution, const eck
                 i_begin_halo_( j ) = imin;
                 i_end_halo_( j )   = imax;
             }
+            for ( idx_t d = 0; d <= halo; ++d ) {
+                i_begin_halo_depth[d].resize( -halo, grid_->ny() - 1 + halo );
+                i_end_halo_depth[d].resize( -halo, grid_->ny() - 1 + halo );
+                for ( idx_t j = j_begin_halo_; j < j_end_halo_; ++j ) {
+                    i_begin_halo_depth[d]( j ) = imin;
+                    i_end_halo_depth[d]( j )   = imax;
+                }
+            }
             double eps = 1.e-12;
             for ( idx_t j = j_begin_; j < j_end_; ++j ) {
                 for ( idx_t i : {i_begin_[j], i_end_[j] - 1} ) {
@@ -282,6 +295,11 @@ void StructuredColumns::setup( const grid::Distribution& distribution, const eck
                         imax                = std::max( imax, i_plus_halo );
                         i_begin_halo_( jj ) = std::min( i_begin_halo_( jj ), i_minus_halo );
                         i_end_halo_( jj )   = std::max( i_end_halo_( jj ), i_plus_halo + 1 );
+
+                        for ( idx_t d = std::max<idx_t>( std::abs( jj - j ), 1 ); d <= halo; ++d ) {
+                            i_begin_halo_depth[d]( jj ) = std::min( i_begin_halo_depth[d]( jj ), ii - d );
+                            i_end_halo_depth[d]( jj )   = std::max( i_end_halo_depth[d]( jj ), iii + d + 1 );
+                        }
                     }
                 }
             }
@@ -350,6 +368,7 @@ void StructuredColumns::setup( const grid::Distribution& distribution, const eck
         field_index_i_      = Field( "index_i", array::make_datatype<idx_t>(), array::make_shape( size_halo_ ) );
         field_index_j_      = Field( "index_j", array::make_datatype<idx_t>(), array::make_shape( size_halo_ ) );
         field_xy_           = Field( "xy", array::make_datatype<double>(), array::make_shape( size_halo_, 2 ) );
+        field_halo_level_   = Field( "halo_level", array::make_datatype<int>(), array::make_shape( size_halo_ ) );
 
         auto xy         = array::make_view<double, 2>( field_xy_ );
         auto part       = array::make_view<int, 1>( field_partition_ );
@@ -357,6 +376,18 @@ void StructuredColumns::setup( const grid::Distribution& distribution, const eck
         auto global_idx = array::make_view<gidx_t, 1>( field_global_index_ );
         auto index_i    = array::make_indexview<idx_t, 1>( field_index_i_ );
         auto index_j    = array::make_indexview<idx_t, 1>( field_index_j_ );
+        auto halo_level = array::make_view<int, 1>( field_halo_level_ );
+
+        // Smallest halo depth that includes point (i,j)
+        auto compute_halo_level = [&]( idx_t i, idx_t j ) -> int {
+            for ( idx_t d = 1; d < halo; ++d ) {
+                if ( j >= j_begin_ - d && j < j_end_ + d && i >= i_begin_halo_depth[d]( j ) &&
+                     i < i_end_halo_depth[d]( j ) ) {
+                    return d;
+                }
+            }
+            return halo;
+        };
 
         for ( const GridPoint& gp : gridpoints ) {
             xy( gp.r, XX ) = compute_x( gp.i, gp.j );
@@ -380,27 +411,32 @@ void StructuredColumns::setup( const grid::Distribution& distribution, const eck
                 global_idx( gp.r ) = compute_g( gp.i, gp.j );
                 part( gp.r )       = compute_p( gp.i, gp.j );
             }
-            index_i( gp.r ) = gp.i;
-            index_j( gp.r ) = gp.j;
-            ghost( gp.r )   = 0;
+            index_i( gp.r )    = gp.i;
+            index_j( gp.r )    = gp.j;
+            ghost( gp.r )      = 0;
+            halo_level( gp.r ) = 0;
         }
 
         for ( idx_t j = j_begin_halo_; j < j_begin_; ++j ) {
             for ( idx_t i = i_begin_halo_( j ); i < i_end_halo_( j ); ++i ) {
-                ghost( index( i, j ) ) = 1;
+                ghost( index( i, j ) )      = 1;
+                halo_level( index( i, j ) ) = compute_halo_level( i, j );
             }
         }
         for ( idx_t j = j_begin_; j < j_end_; ++j ) {
             for ( idx_t i = i_begin_halo_( j ); i < i_begin_[j]; ++i ) {
-                ghost( index( i, j ) ) = 1;
+                ghost( index( i, j ) )      = 1;
+                halo_level( index( i, j ) ) = compute_halo_level( i, j );
             }
             for ( idx_t i = i_end_[j]; i < i_end_halo_( j ); ++i ) {
-                ghost( index( i, j ) ) = 1;
+                ghost( index( i, j ) )      = 1;
+                halo_level( index( i, j ) ) = compute_halo_level( i, j );
             }
         }
         for ( idx_t j = j_end_; j < j_end_halo_; ++j ) {
             for ( idx_t i = i_begin_halo_( j ); i < i_end_halo_( j ); ++i ) {
-                ghost( index( i, j ) ) = 1;
+                ghost( index( i, j ) )      = 1;
+                halo_level( index( i, j ) ) = compute_halo_level( i, j );
             }
         }
     }
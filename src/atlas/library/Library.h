@@ -57,6 +57,8 @@ public:
 
     bool traceBarriers() const { return trace_barriers_; }
 
+    bool traceReport() const { return trace_report_; }
+
 protected:
     virtual const void* addr() const override;
 
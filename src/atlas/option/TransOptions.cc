@@ -73,6 +73,16 @@ warning::warning( int warning ) {
     set( "warning", warning );
 }
 
+single_precision::single_precision( bool single_precision ) {
+    set( "single_precision", single_precision );
+}
+
+// ----------------------------------------------------------------------------
+
+legendre_tolerance::legendre_tolerance( double tolerance ) {
+    set( "legendre_tolerance", tolerance );
+}
+
 // ----------------------------------------------------------------------------
 
 }  // namespace option
@@ -122,5 +122,21 @@ public:
 
 // ----------------------------------------------------------------------------
 
+/// Use single precision for the Legendre polynomials and Legendre transforms (TransLocal)
+class single_precision : public util::Config {
+public:
+    single_precision( bool = true );
+};
+
+// ----------------------------------------------------------------------------
+
+/// Compress the Legendre polynomials with the given accuracy for fast Legendre transforms (TransLocal)
+class legendre_tolerance : public util::Config {
+public:
+    legendre_tolerance( double );
+};
+
+// ----------------------------------------------------------------------------
+
 }  // namespace option
 }  // namespace atlas
@@ -10,6 +10,8 @@
 
 #include <cstring>
 
+#include "eckit/config/Resource.h"
+
 #include "atlas/parallel/Checksum.h"
 
 namespace atlas {
@@ -45,6 +47,11 @@ void Checksum::setup( const util::ObjectHandle<GatherScatter>& gather ) {
     is_setup_ = true;
 }
 
+bool Checksum::reduction() {
+    static bool reduction = eckit::Resource<bool>( "$ATLAS_CHECKSUM_REDUCTION", true );
+    return reduction;
+}
+
 /////////////////////
 
 Checksum* atlas__Checksum__new() {
@@ -17,6 +17,7 @@
 #include "atlas/array/ArrayView.h"
 #include "atlas/parallel/GatherScatter.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/util/Checksum.h"
 #include "atlas/util/Object.h"
 #include "atlas/util/ObjectHandle.h"
@@ -72,6 +73,11 @@ public:  // methods
     void var_info( const array::ArrayView<DATA_TYPE, RANK>& arr, std::vector<int>& varstrides,
                    std::vector<int>& varextents ) const;
 
+private:  // methods
+    /// @brief Whether checksums are computed with a reduction over tasks (default) rather than by gathering
+    /// a checksum per point to a root task. Controlled by environment variable ATLAS_CHECKSUM_REDUCTION.
+    static bool reduction();
+
 private:  // data
     std::string name_;
     util::ObjectHandle<GatherScatter> gather_;
@@ -87,9 +93,27 @@ std::string Checksum::execute( const DATA_TYPE data[], const int var_strides[],
     if ( !is_setup_ ) {
         throw_Exception( "Checksum was not setup", Here() );
     }
-    std::vector<util::checksum_t> local_checksums( parsize_ );
     int var_size = var_extents[0] * var_strides[0];
 
+    if ( reduction() ) {
+        // Sum of the checksums of all points, each combined with its global index. The sum does not depend
+        // on the order of the points, hence not on the decomposition, and is reduced over tasks in log(P) steps.
+        // As in the gather, every global index is counted once, on the task that owns it (see locmap_).
+        const std::vector<int>& locidx    = gather_->locmap_;
+        const std::vector<gidx_t>& locglb = gather_->locglb_;
+
+        util::checksum_t glb_checksum = 0;
+        for ( size_t j = 0; j < locidx.size(); ++j ) {
+            glb_checksum += util::checksum_combine( util::checksum_t( locglb[j] ),
+                                                    util::checksum( data + locidx[j] * var_size, var_size ) );
+        }
+        ATLAS_TRACE_MPI( ALLREDUCE ) { mpi::comm().allReduceInPlace( glb_checksum, eckit::mpi::sum() ); }
+
+        return eckit::Translator<util::checksum_t, std::string>()( glb_checksum );
+    }
+
+    std::vector<util::checksum_t> local_checksums( parsize_ );
+
     for ( size_t pp = 0; pp < parsize_; ++pp ) {
         local_checksums[pp] = util::checksum( data + pp * var_size, var_size );
     }
@@ -14,12 +14,15 @@
 #include <sstream>
 #include <stdexcept>
 
+#include "eckit/config/Resource.h"
+
 #include "atlas/array.h"
 #include "atlas/array/ArrayView.h"
 #include "atlas/parallel/GatherScatter.h"
 #include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
+#include "atlas/runtime/trace/Timings.h"
 
 namespace atlas {
 namespace parallel {
@@ -65,14 +68,49 @@ struct Node {
     bool operator==( const Node& other ) const { return ( g == other.g ); }
 };
 
-}  // namespace
+/// Nodes from gathered (glb_idx,part,remote_idx) triplets, sorted on global index without duplicates
+std::vector<Node> sorted_nodes( const std::vector<gidx_t>& recvnodes ) {
+    const idx_t nvar          = 3;
+    const idx_t nb_recv_nodes = static_cast<idx_t>( recvnodes.size() ) / nvar;
+    std::vector<Node> node_sort( nb_recv_nodes );
+    for ( idx_t n = 0; n < nb_recv_nodes; ++n ) {
+        node_sort[n].g = recvnodes[n * nvar + 0];
+        node_sort[n].p = recvnodes[n * nvar + 1];
+        node_sort[n].i = recvnodes[n * nvar + 2];
+    }
 
-GatherScatter::GatherScatter() : name_(), is_setup_( false ) {
-    myproc = mpi::comm().rank();
-    nproc  = mpi::comm().size();
+    // Sort on "g" member, and remove duplicates
+    ATLAS_TRACE_SCOPE( "sorting" ) {
+        std::sort( node_sort.begin(), node_sort.end() );
+        node_sort.erase( std::unique( node_sort.begin(), node_sort.end() ), node_sort.end() );
+    }
+    return node_sort;
+}
+
+/// Number of nodes per owning task
+void count_nodes( const std::vector<Node>& node_sort, std::vector<int>& counts ) {
+    std::fill( counts.begin(), counts.end(), 0 );
+    for ( const auto& node : node_sort ) {
+        ++counts[node.p];
+    }
+}
+
+void compute_displs( const std::vector<int>& counts, std::vector<int>& displs ) {
+    displs[0] = 0;
+    for ( size_t jproc = 1; jproc < counts.size(); ++jproc ) {  // start at 1
+        displs[jproc] = counts[jproc - 1] + displs[jproc - 1];
+    }
 }
 
-GatherScatter::GatherScatter( const std::string& name ) : name_( name ), is_setup_( false ) {
+}  // namespace
+
+GatherScatter::GatherScatter() : GatherScatter( std::string() ) {}
+
+GatherScatter::GatherScatter( const std::string& name ) :
+    name_( name ),
+    gather_label_( name.empty() ? "gather" : "gather:" + name ),
+    scatter_label_( name.empty() ? "scatter" : "scatter:" + name ),
+    is_setup_( false ) {
     myproc = mpi::comm().rank();
     nproc  = mpi::comm().size();
 }
@@ -100,49 +138,49 @@ void GatherScatter::setup( const int part[], const idx_t remote_idx[], const int
         }
     }
 
+    sendnodes.resize( loccnt_ );
+
+    if ( scalable_setup() ) {
+        roots_.assign( 1, 0 );
+        setup_on_root( sendnodes, roots_.front() );
+    }
+    else {
+        roots_.clear();
+        setup_on_all( sendnodes );
+    }
+
+    // Points are unique in locmap_, even when a global index is unmasked on several tasks
+    locglb_.resize( loccnt_ );
+    for ( idx_t j = 0; j < loccnt_; ++j ) {
+        locglb_[j] = glb_idx[locmap_[j]];
+    }
+
+    is_setup_ = true;
+}
+
+bool GatherScatter::scalable_setup() {
+    static bool scalable = eckit::Resource<bool>( "$ATLAS_GATHER_SCATTER_SCALABLE_SETUP", true );
+    return scalable;
+}
+
+void GatherScatter::setup_on_all( const std::vector<gidx_t>& sendnodes ) {
     ATLAS_TRACE_MPI( ALLGATHER ) { mpi::comm().allGather( loccnt_, glbcounts_.begin(), glbcounts_.end() ); }
 
     glbcnt_ = std::accumulate( glbcounts_.begin(), glbcounts_.end(), 0 );
+    compute_displs( glbcounts_, glbdispls_ );
 
-    glbdispls_[0] = 0;
-    for ( idx_t jproc = 1; jproc < nproc; ++jproc )  // start at 1
-    {
-        glbdispls_[jproc] = glbcounts_[jproc - 1] + glbdispls_[jproc - 1];
-    }
     std::vector<gidx_t> recvnodes( glbcnt_ );
 
     ATLAS_TRACE_MPI( ALLGATHER ) {
-        mpi::comm().allGatherv( sendnodes.begin(), sendnodes.begin() + loccnt_, recvnodes.data(), glbcounts_.data(),
+        mpi::comm().allGatherv( sendnodes.begin(), sendnodes.end(), recvnodes.data(), glbcounts_.data(),
                                 glbdispls_.data() );
     }
 
-    // Load recvnodes in sorting structure
-    idx_t nb_recv_nodes = glbcnt_ / nvar;
-    std::vector<Node> node_sort( nb_recv_nodes );
-    for ( idx_t n = 0; n < nb_recv_nodes; ++n ) {
-        node_sort[n].g = recvnodes[n * nvar + 0];
-        node_sort[n].p = recvnodes[n * nvar + 1];
-        node_sort[n].i = recvnodes[n * nvar + 2];
-    }
-
+    std::vector<Node> node_sort = sorted_nodes( recvnodes );
     recvnodes.clear();
 
-    // Sort on "g" member, and remove duplicates
-    ATLAS_TRACE_SCOPE( "sorting" ) {
-        std::sort( node_sort.begin(), node_sort.end() );
-        node_sort.erase( std::unique( node_sort.begin(), node_sort.end() ), node_sort.end() );
-    }
-    glbcounts_.assign( nproc, 0 );
-    glbdispls_.assign( nproc, 0 );
-    for ( size_t n = 0; n < node_sort.size(); ++n ) {
-        ++glbcounts_[node_sort[n].p];
-    }
-    glbdispls_[0] = 0;
-
-    for ( idx_t jproc = 1; jproc < nproc; ++jproc )  // start at 1
-    {
-        glbdispls_[jproc] = glbcounts_[jproc - 1] + glbdispls_[jproc - 1];
-    }
+    count_nodes( node_sort, glbcounts_ );
+    compute_displs( glbcounts_, glbdispls_ );
     glbcnt_ = std::accumulate( glbcounts_.begin(), glbcounts_.end(), 0 );
     loccnt_ = glbcounts_[myproc];
 
@@ -163,8 +201,73 @@ void GatherScatter::setup( const int part[], const idx_t remote_idx[], const int
 
         ++idx[jproc];
     }
+}
 
-    is_setup_ = true;
+void GatherScatter::setup_on_root( const std::vector<gidx_t>& sendnodes, idx_t root ) {
+    ATLAS_TRACE_MPI( GATHER ) { mpi::comm().gather( loccnt_, glbcounts_, root ); }
+
+    compute_displs( glbcounts_, glbdispls_ );
+
+    std::vector<gidx_t> recvnodes( myproc == root ? std::accumulate( glbcounts_.begin(), glbcounts_.end(), 0 ) : 0 );
+
+    ATLAS_TRACE_MPI( GATHER ) {
+        mpi::comm().gatherv( sendnodes.data(), sendnodes.size(), recvnodes.data(), glbcounts_.data(),
+                             glbdispls_.data(), root );
+    }
+
+    // Local maps of all tasks, concatenated in task order
+    std::vector<int> locmaps;
+
+    glbmap_.clear();
+    if ( myproc == root ) {
+        std::vector<Node> node_sort = sorted_nodes( recvnodes );
+        recvnodes.clear();
+
+        count_nodes( node_sort, glbcounts_ );
+        compute_displs( glbcounts_, glbdispls_ );
+        glbcnt_ = std::accumulate( glbcounts_.begin(), glbcounts_.end(), 0 );
+
+        glbmap_.resize( glbcnt_ );
+        locmaps.resize( glbcnt_ );
+        std::vector<int> idx( nproc, 0 );
+
+        int n{0};
+        for ( const auto& node : node_sort ) {
+            idx_t jproc                             = node.p;
+            glbmap_[glbdispls_[jproc] + idx[jproc]] = n++;
+            locmaps[glbdispls_[jproc] + idx[jproc]] = node.i;
+            ++idx[jproc];
+        }
+    }
+
+    ATLAS_TRACE_MPI( BROADCAST ) { mpi::comm().broadcast( glbcounts_.begin(), glbcounts_.end(), root ); }
+
+    compute_displs( glbcounts_, glbdispls_ );
+    glbcnt_ = std::accumulate( glbcounts_.begin(), glbcounts_.end(), 0 );
+    loccnt_ = glbcounts_[myproc];
+
+    locmap_.clear();
+    locmap_.resize( loccnt_ );
+    ATLAS_TRACE_MPI( SCATTER ) {
+        mpi::comm().scatterv( locmaps.data(), glbcounts_.data(), glbdispls_.data(), locmap_.data(), loccnt_, root );
+    }
+}
+
+void GatherScatter::require_root( idx_t root ) const {
+    if ( roots_.empty() || std::find( roots_.begin(), roots_.end(), root ) != roots_.end() ) {
+        return;
+    }
+    ATLAS_TRACE( "GatherScatter::require_root" );
+    const idx_t source = roots_.front();
+    const int tag      = 4;
+    if ( myproc == source ) {
+        ATLAS_TRACE_MPI( SENDRECEIVE ) { mpi::comm().send( glbmap_.data(), glbmap_.size(), root, tag ); }
+    }
+    if ( myproc == root ) {
+        glbmap_.resize( glbcnt_ );
+        ATLAS_TRACE_MPI( SENDRECEIVE ) { mpi::comm().receive( glbmap_.data(), glbmap_.size(), source, tag ); }
+    }
+    roots_.emplace_back( root );
 }
 
 void GatherScatter::setup( const int part[], const idx_t remote_idx[], const int base, const gidx_t glb_idx[],
@@ -177,6 +280,43 @@ void GatherScatter::setup( const int part[], const idx_t remote_idx[], const int
     setup( part, remote_idx, base, glb_idx, mask.data(), parsize );
 }
 
+void GatherScatter::record_communication( const std::string& label, size_t loc_bytes, size_t glb_bytes, idx_t root,
+                                          bool to_root ) const {
+    if ( !runtime::trace::Timings::communication_enabled() ) {
+        return;
+    }
+    // Every task exchanges one message with root, root exchanges one message with every task
+    const bool is_root            = ( myproc == root );
+    const size_t nb_root_messages = is_root ? size_t( nproc ) : 0;
+    runtime::trace::Timings::Communication communication;
+    communication.count             = 1;
+    communication.messages_sent     = to_root ? 1 : nb_root_messages;
+    communication.messages_received = to_root ? nb_root_messages : 1;
+    communication.bytes_sent        = to_root ? loc_bytes : glb_bytes;
+    communication.bytes_received    = to_root ? glb_bytes : loc_bytes;
+    communication.neighbours        = is_root ? size_t( nproc - 1 ) : 1;
+    runtime::trace::Timings::update( label, communication );
+}
+
+void GatherScatter::record_communication( const std::string& label, const std::vector<int>& send_counts,
+                                          const std::vector<int>& recv_counts, size_t datatype_size ) const {
+    if ( !runtime::trace::Timings::communication_enabled() ) {
+        return;
+    }
+    runtime::trace::Timings::Communication communication;
+    communication.count = 1;
+    for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
+        communication.messages_sent += send_counts[jproc] > 0 ? 1 : 0;
+        communication.messages_received += recv_counts[jproc] > 0 ? 1 : 0;
+        communication.bytes_sent += size_t( send_counts[jproc] ) * datatype_size;
+        communication.bytes_received += size_t( recv_counts[jproc] ) * datatype_size;
+        if ( jproc != myproc && ( send_counts[jproc] > 0 || recv_counts[jproc] > 0 ) ) {
+            ++communication.neighbours;
+        }
+    }
+    runtime::trace::Timings::update( label, communication );
+}
+
 /////////////////////
 
 GatherScatter* atlas__GatherScatter__new() {
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <numeric>
 #include <stdexcept>
 #include <vector>
@@ -64,48 +66,47 @@ public:
         var_shape.assign( 1, nb_vars );
     }
 
+    /// @param [in] parallel_dim  Position of the parallel dimension in arr, which may be any dimension
     template <int RANK>
-    Field( const array::ArrayView<NON_CONST_DATA_TYPE, RANK>& arr ) {
+    Field( const array::ArrayView<NON_CONST_DATA_TYPE, RANK>& arr, idx_t parallel_dim = 0 ) {
         data = const_cast<DATA_TYPE*>( arr.data() );
 
         var_rank = RANK;
         var_strides.resize( var_rank );
         var_shape.resize( var_rank );
 
-        if ( arr.rank() > 1 ) {
-            var_strides[0] = arr.stride( 0 );
-            var_shape[0]   = 1;
-            for ( int j = 1; j < RANK; ++j ) {
-                var_strides[j] = arr.stride( j );
-                var_shape[j]   = arr.shape( j );
+        // The parallel dimension becomes a dummy first variable dimension, followed by the other dimensions
+        ATLAS_ASSERT( parallel_dim >= 0 && parallel_dim < RANK );
+        var_strides[0] = arr.stride( parallel_dim );
+        var_shape[0]   = 1;
+        for ( int j = 0, jvar = 1; j < RANK; ++j ) {
+            if ( j != parallel_dim ) {
+                var_strides[jvar] = arr.stride( j );
+                var_shape[jvar]   = arr.shape( j );
+                ++jvar;
             }
         }
-        else {
-            var_strides[0] = arr.stride( 0 );
-            var_shape[0]   = 1;
-        }
     }
 
     template <int RANK>
-    Field( const array::LocalView<NON_CONST_DATA_TYPE, RANK>& arr ) {
+    Field( const array::LocalView<NON_CONST_DATA_TYPE, RANK>& arr, idx_t parallel_dim = 0 ) {
         data = const_cast<DATA_TYPE*>( arr.data() );
 
         var_rank = RANK;
         var_strides.resize( var_rank );
         var_shape.resize( var_rank );
 
-        if ( arr.rank() > 1 ) {
-            var_strides[0] = arr.stride( 0 );
-            var_shape[0]   = 1;
-            for ( int j = 1; j < RANK; ++j ) {
-                var_strides[j] = arr.stride( j );
-                var_shape[j]   = arr.shape( j );
+        // The parallel dimension becomes a dummy first variable dimension, followed by the other dimensions
+        ATLAS_ASSERT( parallel_dim >= 0 && parallel_dim < RANK );
+        var_strides[0] = arr.stride( parallel_dim );
+        var_shape[0]   = 1;
+        for ( int j = 0, jvar = 1; j < RANK; ++j ) {
+            if ( j != parallel_dim ) {
+                var_strides[jvar] = arr.stride( j );
+                var_shape[jvar]   = arr.shape( j );
+                ++jvar;
             }
         }
-        else {
-            var_strides[0] = arr.stride( 0 );
-            var_shape[0]   = 1;
-        }
     }
 
 public:
@@ -159,10 +160,27 @@ public:  // methods
     void gather( parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
                  const idx_t nb_fields, const idx_t root = 0 ) const;
 
+    /// @brief Gather multiple fields at once, field jfield to task roots[jfield]
+    ///
+    /// When the roots differ, all fields are communicated with a single all-to-all, so that the roots
+    /// assemble their fields in parallel, e.g. with fields spread round-robin over a set of output tasks.
+    /// Every root only needs memory for the global fields it owns.
+    template <typename DATA_TYPE>
+    void gather( parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
+                 const idx_t nb_fields, const std::vector<idx_t>& roots ) const;
+
+    /// @brief Gather with the parallel dimension being dimension 0 of ldata and gdata.
+    /// Use the overload with parallel_dim for other layouts.
     template <typename DATA_TYPE, int LRANK, int GRANK>
     void gather( const array::ArrayView<DATA_TYPE, LRANK>& ldata, array::ArrayView<DATA_TYPE, GRANK>& gdata,
                  const idx_t root = 0 ) const;
 
+    /// @brief Gather with the parallel dimension at position parallel_dim of both ldata and gdata,
+    /// e.g. for level-first or blocked layouts, without transposing to a point-first layout
+    template <typename DATA_TYPE, int LRANK, int GRANK>
+    void gather( const array::ArrayView<DATA_TYPE, LRANK>& ldata, array::ArrayView<DATA_TYPE, GRANK>& gdata,
+                 const idx_t root, const idx_t parallel_dim ) const;
+
     template <typename DATA_TYPE>
     void scatter( parallel::Field<DATA_TYPE const> gfields[], parallel::Field<DATA_TYPE> lfields[],
                   const idx_t nb_fields, const idx_t root = 0 ) const;
@@ -178,15 +196,62 @@ public:  // methods
                   DATA_TYPE ldata[], const idx_t lvar_strides[], const idx_t lvar_shape[], const idx_t lvar_rank,
                   const idx_t root = 0 ) const;
 
+    /// @brief Scatter with the parallel dimension being dimension 0 of gdata and ldata.
+    /// Use the overload with parallel_dim for other layouts.
     template <typename DATA_TYPE, int GRANK, int LRANK>
     void scatter( const array::ArrayView<DATA_TYPE, GRANK>& gdata, array::ArrayView<DATA_TYPE, LRANK>& ldata,
                   const idx_t root = 0 ) const;
 
+    /// @brief Scatter with the parallel dimension at position parallel_dim of both gdata and ldata
+    template <typename DATA_TYPE, int GRANK, int LRANK>
+    void scatter( const array::ArrayView<DATA_TYPE, GRANK>& gdata, array::ArrayView<DATA_TYPE, LRANK>& ldata,
+                  const idx_t root, const idx_t parallel_dim ) const;
+
+    /// @brief Callbacks of the streaming gather and scatter, called on root for every chunk of levels
+    /// [level_begin, level_end), in increasing order.
+    /// A chunk is contiguous and ordered by global index, then by the variable dimensions of the field,
+    /// its level dimension being reduced to the levels of the chunk.
+    template <typename DATA_TYPE>
+    struct Streaming {
+        using GatherCallback  = std::function<void( const DATA_TYPE chunk[], idx_t level_begin, idx_t level_end )>;
+        using ScatterCallback = std::function<void( DATA_TYPE chunk[], idx_t level_begin, idx_t level_end )>;
+    };
+
+    /// @brief Streaming gather, assembling the global field on root in chunks of at most levels_per_chunk
+    /// levels, each passed to callback. Root memory is bounded by two chunks, and root receives the next
+    /// chunk while the callback processes the current one, e.g. to overlap writing to disk with communication.
+    /// The levels are the second variable dimension of lfield, as for a leveled view
+    /// (a field with a single variable dimension has one level).
+    template <typename DATA_TYPE>
+    void gather( const parallel::Field<DATA_TYPE const>& lfield, const idx_t levels_per_chunk,
+                 const typename Streaming<DATA_TYPE>::GatherCallback& callback, const idx_t root = 0 ) const;
+
+    /// @brief Streaming scatter, the counterpart of the streaming gather: callback fills every chunk
+    /// of levels on root, which is sent while the callback fills the next chunk
+    template <typename DATA_TYPE>
+    void scatter( const typename Streaming<DATA_TYPE>::ScatterCallback& callback, const idx_t levels_per_chunk,
+                  const parallel::Field<DATA_TYPE>& lfield, const idx_t root = 0 ) const;
+
     gidx_t glb_dof() const { return glbcnt_; }
 
     idx_t loc_dof() const { return loccnt_; }
 
 private:  // methods
+    /// @brief Whether setup builds the global map on a single root task only (default), so that
+    /// memory per task scales with the number of local points rather than the number of global points.
+    /// Controlled by environment variable ATLAS_GATHER_SCATTER_SCALABLE_SETUP.
+    static bool scalable_setup();
+
+    /// Every task holds the global map, from an all-gather of all global indices
+    void setup_on_all( const std::vector<gidx_t>& sendnodes );
+
+    /// Only root holds the global map, other tasks receive their local map
+    void setup_on_root( const std::vector<gidx_t>& sendnodes, idx_t root );
+
+    /// Make sure root holds the global map, copying it from a task that does when needed.
+    /// Must be called by all tasks, like gather() and scatter()
+    void require_root( idx_t root ) const;
+
     template <typename DATA_TYPE>
     void pack_send_buffer( const parallel::Field<DATA_TYPE const>& field, const std::vector<int>& sendmap,
                            DATA_TYPE send_buffer[] ) const;
@@ -199,14 +264,44 @@ private:  // methods
     void var_info( const array::ArrayView<DATA_TYPE, RANK>& arr, std::vector<idx_t>& varstrides,
                    std::vector<idx_t>& varshape ) const;
 
+    /// Number of levels of a field, being its second variable dimension
+    template <typename DATA_TYPE>
+    static idx_t nb_levels( const parallel::Field<DATA_TYPE>& field ) {
+        return field.var_rank > 1 ? field.var_shape[1] : 1;
+    }
+
+    /// View on levels [level_begin, level_end) of field
+    template <typename DATA_TYPE>
+    static parallel::Field<DATA_TYPE> level_chunk( const parallel::Field<DATA_TYPE>& field, idx_t level_begin,
+                                                   idx_t level_end );
+
+    /// Contiguous field on data, with the variable shape of field restricted to nb_chunk_levels levels
+    template <typename DATA_TYPE, typename FIELD_DATA_TYPE>
+    static parallel::Field<DATA_TYPE> contiguous_level_chunk( DATA_TYPE data[],
+                                                              const parallel::Field<FIELD_DATA_TYPE>& field,
+                                                              idx_t nb_chunk_levels );
+
+    /// @brief Record the communication volume of one gather (or scatter) in runtime::trace::Timings,
+    /// under gather_label_ (or scatter_label_)
+    void record_communication( const std::string& label, size_t loc_bytes, size_t glb_bytes, idx_t root,
+                               bool to_root ) const;
+
+    /// @brief Record the communication volume of one all-to-all with given counts per task
+    void record_communication( const std::string& label, const std::vector<int>& send_counts,
+                               const std::vector<int>& recv_counts, size_t datatype_size ) const;
+
 private:  // data
     std::string name_;
+    std::string gather_label_;   ///< "gather:<name>", or "gather" when unnamed
+    std::string scatter_label_;  ///< "scatter:<name>", or "scatter" when unnamed
     int loccnt_;
     int glbcnt_;
     std::vector<int> glbcounts_;
     std::vector<int> glbdispls_;
     std::vector<int> locmap_;
-    std::vector<int> glbmap_;
+    mutable std::vector<int> glbmap_;
+    mutable std::vector<idx_t> roots_;  ///< Tasks holding glbmap_, empty when all tasks do
+    std::vector<gidx_t> locglb_;        ///< Global index of every point in locmap_
 
     idx_t nproc;
     idx_t myproc;
@@ -227,6 +322,7 @@ void GatherScatter::gather( parallel::Field<DATA_TYPE const> lfields[], parallel
     if ( !is_setup_ ) {
         throw_Exception( "GatherScatter was not setup", Here() );
     }
+    require_root( root );
 
     for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
         const idx_t lvar_size =
@@ -254,6 +350,8 @@ void GatherScatter::gather( parallel::Field<DATA_TYPE const> lfields[], parallel
         /// Gather
 
         ATLAS_TRACE_MPI( GATHER ) { mpi::comm().gatherv( loc_buffer, glb_buffer, glb_counts, glb_displs, root ); }
+        record_communication( gather_label_, loc_size * sizeof( DATA_TYPE ), glb_size * sizeof( DATA_TYPE ), root,
+                              true );
 
         /// Unpack
         if ( myproc == root )
@@ -261,6 +359,79 @@ void GatherScatter::gather( parallel::Field<DATA_TYPE const> lfields[], parallel
     }
 }
 
+template <typename DATA_TYPE>
+void GatherScatter::gather( parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
+                            const idx_t nb_fields, const std::vector<idx_t>& roots ) const {
+    if ( !is_setup_ ) {
+        throw_Exception( "GatherScatter was not setup", Here() );
+    }
+    ATLAS_ASSERT( idx_t( roots.size() ) == nb_fields );
+    if ( nb_fields == 0 ) {
+        return;
+    }
+    if ( std::all_of( roots.begin(), roots.end(), [&roots]( idx_t root ) { return root == roots.front(); } ) ) {
+        gather( lfields, gfields, nb_fields, roots.front() );
+        return;
+    }
+    for ( idx_t root : roots ) {
+        require_root( root );
+    }
+
+    std::vector<idx_t> var_size( nb_fields );
+    std::vector<int> send_counts( nproc, 0 );
+    std::vector<int> recv_counts( nproc, 0 );
+    for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+        var_size[jfield] =
+            std::accumulate( lfields[jfield].var_shape.data(),
+                             lfields[jfield].var_shape.data() + lfields[jfield].var_rank, 1, std::multiplies<idx_t>() );
+        send_counts[roots[jfield]] += loccnt_ * var_size[jfield];
+        if ( roots[jfield] == myproc ) {
+            for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
+                recv_counts[jproc] += glbcounts_[jproc] * var_size[jfield];
+            }
+        }
+    }
+    std::vector<int> send_displs( nproc, 0 );
+    std::vector<int> recv_displs( nproc, 0 );
+    for ( idx_t jproc = 1; jproc < nproc; ++jproc ) {
+        send_displs[jproc] = send_displs[jproc - 1] + send_counts[jproc - 1];
+        recv_displs[jproc] = recv_displs[jproc - 1] + recv_counts[jproc - 1];
+    }
+    std::vector<DATA_TYPE> send_buffer( send_displs.back() + send_counts.back() );
+    std::vector<DATA_TYPE> recv_buffer( recv_displs.back() + recv_counts.back() );
+
+    /// Pack, ordered by root and then by field
+    std::vector<int> send_offset( send_displs );
+    for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+        pack_send_buffer( lfields[jfield], locmap_, send_buffer.data() + send_offset[roots[jfield]] );
+        send_offset[roots[jfield]] += loccnt_ * var_size[jfield];
+    }
+
+    /// Gather all fields to their roots at once
+
+    ATLAS_TRACE_MPI( ALLTOALL ) {
+        mpi::comm().allToAllv( send_buffer.data(), send_counts.data(), send_displs.data(), recv_buffer.data(),
+                               recv_counts.data(), recv_displs.data() );
+    }
+    record_communication( gather_label_, send_counts, recv_counts, sizeof( DATA_TYPE ) );
+
+    /// Unpack the fields of this root, the contribution of every task is ordered by field
+    std::vector<int> recv_offset( recv_displs );
+    for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+        if ( roots[jfield] != myproc ) {
+            continue;
+        }
+        std::vector<DATA_TYPE> glb_buffer( glbcnt_ * var_size[jfield] );
+        for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
+            const int count = glbcounts_[jproc] * var_size[jfield];
+            std::copy( recv_buffer.data() + recv_offset[jproc], recv_buffer.data() + recv_offset[jproc] + count,
+                       glb_buffer.data() + glbdispls_[jproc] * var_size[jfield] );
+            recv_offset[jproc] += count;
+        }
+        unpack_recv_buffer( glbmap_, glb_buffer.data(), gfields[jfield] );
+    }
+}
+
 template <typename DATA_TYPE>
 void GatherScatter::gather( const DATA_TYPE ldata[], const idx_t lvar_strides[], const idx_t lvar_shape[],
                             const idx_t lvar_rank, DATA_TYPE gdata[], const idx_t gvar_strides[],
@@ -276,6 +447,7 @@ void GatherScatter::scatter( parallel::Field<DATA_TYPE const> gfields[], paralle
     if ( !is_setup_ ) {
         throw_Exception( "GatherScatter was not setup", Here() );
     }
+    require_root( root );
 
     for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
         const int lvar_size =
@@ -306,6 +478,8 @@ void GatherScatter::scatter( parallel::Field<DATA_TYPE const> gfields[], paralle
             mpi::comm().scatterv( glb_buffer.begin(), glb_buffer.end(), glb_counts, glb_displs, loc_buffer.begin(),
                                   loc_buffer.end(), root );
         }
+        record_communication( scatter_label_, loc_size * sizeof( DATA_TYPE ), glb_size * sizeof( DATA_TYPE ), root,
+                              false );
 
         /// Unpack
         unpack_recv_buffer( locmap_, loc_buffer.data(), lfields[jfield] );
@@ -321,6 +495,197 @@ void GatherScatter::scatter( const DATA_TYPE gdata[], const idx_t gvar_strides[]
     scatter( &gfield, &lfield, 1, root );
 }
 
+template <typename DATA_TYPE>
+void GatherScatter::gather( const parallel::Field<DATA_TYPE const>& lfield, const idx_t levels_per_chunk,
+                            const typename Streaming<DATA_TYPE>::GatherCallback& callback, const idx_t root ) const {
+    if ( !is_setup_ ) {
+        throw_Exception( "GatherScatter was not setup", Here() );
+    }
+    ATLAS_ASSERT( levels_per_chunk > 0 );
+    require_root( root );
+
+    const int tag          = 5;
+    const idx_t nb_lev     = nb_levels( lfield );
+    const idx_t nb_chunks  = ( nb_lev + levels_per_chunk - 1 ) / levels_per_chunk;
+    const idx_t level_size = std::accumulate( lfield.var_shape.data(), lfield.var_shape.data() + lfield.var_rank, 1,
+                                              std::multiplies<idx_t>() ) /
+                             std::max<idx_t>( nb_lev, 1 );
+
+    auto level_begin = [&]( idx_t jchunk ) { return jchunk * levels_per_chunk; };
+    auto level_end   = [&]( idx_t jchunk ) { return std::min( ( jchunk + 1 ) * levels_per_chunk, nb_lev ); };
+    auto chunk_size  = [&]( idx_t jchunk ) { return ( level_end( jchunk ) - level_begin( jchunk ) ) * level_size; };
+
+    if ( myproc != root ) {
+        std::vector<DATA_TYPE> send_buffer;
+        for ( idx_t jchunk = 0; jchunk < nb_chunks; ++jchunk ) {
+            send_buffer.resize( loccnt_ * chunk_size( jchunk ) );
+            pack_send_buffer( level_chunk( lfield, level_begin( jchunk ), level_end( jchunk ) ), locmap_,
+                              send_buffer.data() );
+            if ( loccnt_ ) {
+                ATLAS_TRACE_MPI( SENDRECEIVE ) {
+                    mpi::comm().send( send_buffer.data(), send_buffer.size(), root, tag );
+                }
+            }
+            record_communication( gather_label_, send_buffer.size() * sizeof( DATA_TYPE ), 0, root, true );
+        }
+        return;
+    }
+
+    // Root holds two chunks: once a chunk is unpacked into "chunk", the next one is received into
+    // "recv_buffer" while the callback processes the current one
+    std::vector<DATA_TYPE> recv_buffer;
+    std::vector<eckit::mpi::Request> recv_requests;
+    std::vector<DATA_TYPE> chunk;
+
+    auto post_receives = [&]( idx_t jchunk ) {
+        const idx_t size = chunk_size( jchunk );
+        recv_buffer.resize( glbcnt_ * size );
+        recv_requests.clear();
+        ATLAS_TRACE_MPI( IRECEIVE ) {
+            for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
+                if ( jproc != root && glbcounts_[jproc] ) {
+                    recv_requests.push_back( mpi::comm().iReceive( recv_buffer.data() + glbdispls_[jproc] * size,
+                                                                   glbcounts_[jproc] * size, jproc, tag ) );
+                }
+            }
+        }
+        pack_send_buffer( level_chunk( lfield, level_begin( jchunk ), level_end( jchunk ) ), locmap_,
+                          recv_buffer.data() + glbdispls_[root] * size );
+    };
+
+    if ( nb_chunks ) {
+        post_receives( 0 );
+    }
+    for ( idx_t jchunk = 0; jchunk < nb_chunks; ++jchunk ) {
+        ATLAS_TRACE_MPI( WAIT ) {
+            for ( auto& request : recv_requests ) {
+                mpi::comm().wait( request );
+            }
+        }
+        record_communication( gather_label_, loccnt_ * chunk_size( jchunk ) * sizeof( DATA_TYPE ),
+                              recv_buffer.size() * sizeof( DATA_TYPE ), root, true );
+
+        /// Unpack in order of global index
+        chunk.resize( glbcnt_ * chunk_size( jchunk ) );
+        unpack_recv_buffer( glbmap_, recv_buffer.data(),
+                            contiguous_level_chunk( chunk.data(), lfield, level_end( jchunk ) - level_begin( jchunk ) ) );
+
+        if ( jchunk + 1 < nb_chunks ) {
+            post_receives( jchunk + 1 );
+        }
+        callback( chunk.data(), level_begin( jchunk ), level_end( jchunk ) );
+    }
+}
+
+template <typename DATA_TYPE>
+void GatherScatter::scatter( const typename Streaming<DATA_TYPE>::ScatterCallback& callback,
+                             const idx_t levels_per_chunk, const parallel::Field<DATA_TYPE>& lfield,
+                             const idx_t root ) const {
+    if ( !is_setup_ ) {
+        throw_Exception( "GatherScatter was not setup", Here() );
+    }
+    ATLAS_ASSERT( levels_per_chunk > 0 );
+    require_root( root );
+
+    const int tag          = 6;
+    const idx_t nb_lev     = nb_levels( lfield );
+    const idx_t nb_chunks  = ( nb_lev + levels_per_chunk - 1 ) / levels_per_chunk;
+    const idx_t level_size = std::accumulate( lfield.var_shape.data(), lfield.var_shape.data() + lfield.var_rank, 1,
+                                              std::multiplies<idx_t>() ) /
+                             std::max<idx_t>( nb_lev, 1 );
+
+    auto level_begin = [&]( idx_t jchunk ) { return jchunk * levels_per_chunk; };
+    auto level_end   = [&]( idx_t jchunk ) { return std::min( ( jchunk + 1 ) * levels_per_chunk, nb_lev ); };
+    auto chunk_size  = [&]( idx_t jchunk ) { return ( level_end( jchunk ) - level_begin( jchunk ) ) * level_size; };
+
+    if ( myproc != root ) {
+        std::vector<DATA_TYPE> recv_buffer;
+        for ( idx_t jchunk = 0; jchunk < nb_chunks; ++jchunk ) {
+            recv_buffer.resize( loccnt_ * chunk_size( jchunk ) );
+            if ( loccnt_ ) {
+                ATLAS_TRACE_MPI( SENDRECEIVE ) {
+                    mpi::comm().receive( recv_buffer.data(), recv_buffer.size(), root, tag );
+                }
+            }
+            record_communication( scatter_label_, recv_buffer.size() * sizeof( DATA_TYPE ), 0, root, false );
+            unpack_recv_buffer( locmap_, recv_buffer.data(),
+                                level_chunk( lfield, level_begin( jchunk ), level_end( jchunk ) ) );
+        }
+        return;
+    }
+
+    // Root holds two chunks: "send_buffer" is in flight while the callback fills the next chunk in "chunk"
+    std::vector<DATA_TYPE> send_buffer;
+    std::vector<eckit::mpi::Request> send_requests;
+    std::vector<DATA_TYPE> chunk;
+
+    auto wait_sends = [&]() {
+        ATLAS_TRACE_MPI( WAIT ) {
+            for ( auto& request : send_requests ) {
+                mpi::comm().wait( request );
+            }
+        }
+        send_requests.clear();
+    };
+
+    for ( idx_t jchunk = 0; jchunk < nb_chunks; ++jchunk ) {
+        const idx_t size = chunk_size( jchunk );
+
+        chunk.resize( glbcnt_ * size );
+        callback( chunk.data(), level_begin( jchunk ), level_end( jchunk ) );
+
+        wait_sends();
+
+        /// Pack in order of task
+        send_buffer.resize( glbcnt_ * size );
+        pack_send_buffer(
+            contiguous_level_chunk( const_cast<const DATA_TYPE*>( chunk.data() ), lfield,
+                                    level_end( jchunk ) - level_begin( jchunk ) ),
+            glbmap_, send_buffer.data() );
+
+        ATLAS_TRACE_MPI( ISEND ) {
+            for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
+                if ( jproc != root && glbcounts_[jproc] ) {
+                    send_requests.push_back( mpi::comm().iSend( send_buffer.data() + glbdispls_[jproc] * size,
+                                                                glbcounts_[jproc] * size, jproc, tag ) );
+                }
+            }
+        }
+        record_communication( scatter_label_, loccnt_ * size * sizeof( DATA_TYPE ),
+                              send_buffer.size() * sizeof( DATA_TYPE ), root, false );
+
+        unpack_recv_buffer( locmap_, send_buffer.data() + glbdispls_[root] * size,
+                            level_chunk( lfield, level_begin( jchunk ), level_end( jchunk ) ) );
+    }
+    wait_sends();
+}
+
+template <typename DATA_TYPE>
+parallel::Field<DATA_TYPE> GatherScatter::level_chunk( const parallel::Field<DATA_TYPE>& field, idx_t level_begin,
+                                                       idx_t level_end ) {
+    parallel::Field<DATA_TYPE> chunk( field );
+    if ( field.var_rank > 1 ) {
+        chunk.data += level_begin * field.var_strides[1];
+        chunk.var_shape[1] = level_end - level_begin;
+    }
+    return chunk;
+}
+
+template <typename DATA_TYPE, typename FIELD_DATA_TYPE>
+parallel::Field<DATA_TYPE> GatherScatter::contiguous_level_chunk( DATA_TYPE data[],
+                                                                  const parallel::Field<FIELD_DATA_TYPE>& field,
+                                                                  idx_t nb_chunk_levels ) {
+    std::vector<idx_t> shape( field.var_shape );
+    if ( field.var_rank > 1 ) {
+        shape[1] = nb_chunk_levels;
+    }
+    std::vector<idx_t> strides( field.var_rank, 1 );
+    for ( idx_t j = field.var_rank - 2; j >= 0; --j ) {
+        strides[j] = strides[j + 1] * shape[j + 1];
+    }
+    return parallel::Field<DATA_TYPE>( data, strides.data(), shape.data(), field.var_rank );
+}
+
 template <typename DATA_TYPE>
 void GatherScatter::pack_send_buffer( const parallel::Field<DATA_TYPE const>& field, const std::vector<int>& sendmap,
                                       DATA_TYPE send_buffer[] ) const {
@@ -364,6 +729,23 @@ void GatherScatter::pack_send_buffer( const parallel::Field<DATA_TYPE const>& fi
                 }
             }
             break;
+        case 4:
+            for ( idx_t p = 0; p < sendcnt; ++p ) {
+                const idx_t pp = send_stride * sendmap[p];
+                for ( idx_t i = 0; i < field.var_shape[0]; ++i ) {
+                    const idx_t ii = pp + i * field.var_strides[0];
+                    for ( idx_t j = 0; j < field.var_shape[1]; ++j ) {
+                        const idx_t jj = ii + j * field.var_strides[1];
+                        for ( idx_t k = 0; k < field.var_shape[2]; ++k ) {
+                            const idx_t kk = jj + k * field.var_strides[2];
+                            for ( idx_t l = 0; l < field.var_shape[3]; ++l ) {
+                                send_buffer[ibuf++] = field.data[kk + l * field.var_strides[3]];
+                            }
+                        }
+                    }
+                }
+            }
+            break;
         default:
             ATLAS_NOTIMPLEMENTED;
     }
@@ -411,6 +793,23 @@ void GatherScatter::unpack_recv_buffer( const std::vector<int>& recvmap, const D
                 }
             }
             break;
+        case 4:
+            for ( idx_t p = 0; p < recvcnt; ++p ) {
+                const idx_t pp = recv_stride * recvmap[p];
+                for ( idx_t i = 0; i < field.var_shape[0]; ++i ) {
+                    const idx_t ii = pp + i * field.var_strides[0];
+                    for ( idx_t j = 0; j < field.var_shape[1]; ++j ) {
+                        const idx_t jj = ii + j * field.var_strides[1];
+                        for ( idx_t k = 0; k < field.var_shape[2]; ++k ) {
+                            const idx_t kk = jj + k * field.var_strides[2];
+                            for ( idx_t l = 0; l < field.var_shape[3]; ++l ) {
+                                field.data[kk + l * field.var_strides[3]] = recv_buffer[ibuf++];
+                            }
+                        }
+                    }
+                }
+            }
+            break;
         default:
             ATLAS_NOTIMPLEMENTED;
     }
@@ -442,27 +841,35 @@ void GatherScatter::var_info( const array::ArrayView<DATA_TYPE, RANK>& arr, std:
 template <typename DATA_TYPE, int LRANK, int GRANK>
 void GatherScatter::gather( const array::ArrayView<DATA_TYPE, LRANK>& ldata, array::ArrayView<DATA_TYPE, GRANK>& gdata,
                             const idx_t root ) const {
-    if ( ldata.shape( 0 ) == parsize_ && gdata.shape( 0 ) == idx_t( glb_cnt( root ) ) ) {
-        std::vector<parallel::Field<DATA_TYPE const>> lfields( 1, parallel::Field<DATA_TYPE const>( ldata ) );
-        std::vector<parallel::Field<DATA_TYPE>> gfields( 1, parallel::Field<DATA_TYPE>( gdata ) );
-        gather( lfields.data(), gfields.data(), 1, root );
-    }
-    else {
-        ATLAS_NOTIMPLEMENTED;  // Need to implement with parallel ranks > 1
-    }
+    gather( ldata, gdata, root, 0 );
+}
+
+template <typename DATA_TYPE, int LRANK, int GRANK>
+void GatherScatter::gather( const array::ArrayView<DATA_TYPE, LRANK>& ldata, array::ArrayView<DATA_TYPE, GRANK>& gdata,
+                            const idx_t root, const idx_t parallel_dim ) const {
+    ATLAS_ASSERT( parallel_dim < LRANK && parallel_dim < GRANK );
+    ATLAS_ASSERT( ldata.shape( parallel_dim ) == parsize_ );
+    ATLAS_ASSERT( myproc != root || gdata.shape( parallel_dim ) == idx_t( glb_cnt( root ) ) );
+    std::vector<parallel::Field<DATA_TYPE const>> lfields( 1, parallel::Field<DATA_TYPE const>( ldata, parallel_dim ) );
+    std::vector<parallel::Field<DATA_TYPE>> gfields( 1, parallel::Field<DATA_TYPE>( gdata, parallel_dim ) );
+    gather( lfields.data(), gfields.data(), 1, root );
 }
 
 template <typename DATA_TYPE, int GRANK, int LRANK>
 void GatherScatter::scatter( const array::ArrayView<DATA_TYPE, GRANK>& gdata, array::ArrayView<DATA_TYPE, LRANK>& ldata,
                              const idx_t root ) const {
-    if ( ldata.shape( 0 ) == parsize_ && gdata.shape( 0 ) == idx_t( glb_cnt( root ) ) ) {
-        std::vector<parallel::Field<DATA_TYPE const>> gfields( 1, parallel::Field<DATA_TYPE const>( gdata ) );
-        std::vector<parallel::Field<DATA_TYPE>> lfields( 1, parallel::Field<DATA_TYPE>( ldata ) );
-        scatter( gfields.data(), lfields.data(), 1, root );
-    }
-    else {
-        ATLAS_NOTIMPLEMENTED;  // Need to implement with parallel ranks > 1
-    }
+    scatter( gdata, ldata, root, 0 );
+}
+
+template <typename DATA_TYPE, int GRANK, int LRANK>
+void GatherScatter::scatter( const array::ArrayView<DATA_TYPE, GRANK>& gdata, array::ArrayView<DATA_TYPE, LRANK>& ldata,
+                             const idx_t root, const idx_t parallel_dim ) const {
+    ATLAS_ASSERT( parallel_dim < LRANK && parallel_dim < GRANK );
+    ATLAS_ASSERT( ldata.shape( parallel_dim ) == parsize_ );
+    ATLAS_ASSERT( myproc != root || gdata.shape( parallel_dim ) == idx_t( glb_cnt( root ) ) );
+    std::vector<parallel::Field<DATA_TYPE const>> gfields( 1, parallel::Field<DATA_TYPE const>( gdata, parallel_dim ) );
+    std::vector<parallel::Field<DATA_TYPE>> lfields( 1, parallel::Field<DATA_TYPE>( ldata, parallel_dim ) );
+    scatter( gfields.data(), lfields.data(), 1, root );
 }
 
 // ------------------------------------------------------------------
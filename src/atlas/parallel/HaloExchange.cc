@@ -11,19 +11,54 @@
 /// @author Willem Deconinck
 /// @date   Nov 2013
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <sstream>
 #include <stdexcept>
 
+#include "eckit/config/Resource.h"
+#include "eckit/eckit_version.h"
+
 #include "atlas/array/Array.h"
+#include "atlas/array/MakeView.h"
 #include "atlas/parallel/HaloExchange.h"
 #include "atlas/parallel/mpi/Statistics.h"
+#include "atlas/runtime/trace/Timings.h"
+
+// Neighbour discovery in the sparse setup needs non-blocking barriers and request tests.
+// Older eckit versions than this bound (a conservative one) do not have them.
+#if 10000 * ECKIT_MAJOR_VERSION + 100 * ECKIT_MINOR_VERSION >= 12000
+#define ATLAS_HALO_EXCHANGE_HAVE_NBX 1
+#else
+#define ATLAS_HALO_EXCHANGE_HAVE_NBX 0
+#endif
 
 namespace atlas {
 namespace parallel {
 
 namespace {
+
+#if ATLAS_HALO_EXCHANGE_HAVE_NBX
+// Tags of the messages of HaloExchange::setup. They are not used by any other module, so that messages of other
+// modules (e.g. GatherScatter) can not match the receive from any source that neighbour discovery keeps posted.
+const int setup_notify_tag[2] = {7001, 7002};
+const int setup_ack_tag       = 7003;
+const int setup_request_tag   = 7004;
+
+/// Parity of the number of previous setups on the communicator. Setup is collective, so it is the same on all tasks.
+int setup_parity( const eckit::mpi::Comm& comm ) {
+    static std::mutex mutex;
+    static std::map<const eckit::mpi::Comm*, int> nb_setups;
+    std::lock_guard<std::mutex> lock( mutex );
+    return nb_setups[&comm]++ % 2;
+}
+#endif
+
 struct IsGhostPoint {
     IsGhostPoint( const int part[], const idx_t ridx[], const idx_t base, const int N ) {
         part_   = part;
@@ -46,6 +81,85 @@ struct IsGhostPoint {
     const idx_t* ridx_;
     idx_t base_;
 };
+
+// Type-erased access to an array that takes part in a fused multi-array halo exchange
+class FusedArray {
+public:
+    virtual ~FusedArray() = default;
+    virtual size_t datatype_size() const                                    = 0;
+    virtual void pack( const int sendmap[], idx_t sendcnt, char* buffer )   = 0;
+    virtual void unpack( const int recvmap[], idx_t recvcnt, char* buffer ) = 0;
+    size_t bytes_per_point() const { return datatype_size() * var_size_; }
+
+protected:
+    idx_t var_size_;
+};
+
+// BUFFER_TYPE is the data type in which values are sent, see WirePrecision
+template <typename DATA_TYPE, int RANK, typename BUFFER_TYPE = DATA_TYPE>
+class FusedArrayT : public FusedArray {
+public:
+    FusedArrayT( array::Array& array ) : view_( array::make_host_view<DATA_TYPE, RANK>( array ) ) {
+        var_size_ = array::get_var_size<0>( view_ );
+    }
+    size_t datatype_size() const override { return sizeof( BUFFER_TYPE ); }
+    void pack( const int sendmap[], idx_t sendcnt, char* buffer ) override {
+        array::SVector<int> map( const_cast<int*>( sendmap ), sendcnt );
+        array::SVector<BUFFER_TYPE> send_buffer( reinterpret_cast<BUFFER_TYPE*>( buffer ), sendcnt * var_size_ );
+        halo_packer<0, RANK>::pack( sendcnt, map, view_, send_buffer );
+    }
+    void unpack( const int recvmap[], idx_t recvcnt, char* buffer ) override {
+        array::SVector<int> map( const_cast<int*>( recvmap ), recvcnt );
+        array::SVector<BUFFER_TYPE> recv_buffer( reinterpret_cast<BUFFER_TYPE*>( buffer ), recvcnt * var_size_ );
+        halo_packer<0, RANK>::unpack( recvcnt, map, recv_buffer, view_ );
+    }
+
+private:
+    array::ArrayView<DATA_TYPE, RANK> view_;
+};
+
+template <typename DATA_TYPE, typename BUFFER_TYPE = DATA_TYPE>
+FusedArray* make_fused_array( array::Array& array ) {
+    switch ( array.rank() ) {
+        case 1:
+            return new FusedArrayT<DATA_TYPE, 1, BUFFER_TYPE>( array );
+        case 2:
+            return new FusedArrayT<DATA_TYPE, 2, BUFFER_TYPE>( array );
+        case 3:
+            return new FusedArrayT<DATA_TYPE, 3, BUFFER_TYPE>( array );
+        case 4:
+            return new FusedArrayT<DATA_TYPE, 4, BUFFER_TYPE>( array );
+        default:
+            throw_NotImplemented( "Rank not supported in halo exchange", Here() );
+    }
+}
+
+FusedArray* make_fused_array( array::Array& array, WirePrecision precision ) {
+    switch ( array.datatype().kind() ) {
+        case array::DataType::KIND_INT32:
+            return make_fused_array<int>( array );
+        case array::DataType::KIND_INT64:
+            return make_fused_array<long>( array );
+        case array::DataType::KIND_REAL32:
+            return make_fused_array<float>( array );
+        case array::DataType::KIND_REAL64:
+            if ( precision == WirePrecision::Single ) {
+                return make_fused_array<double, float>( array );
+            }
+            return make_fused_array<double>( array );
+        default:
+            throw_NotImplemented( "datatype not supported in halo exchange", Here() );
+    }
+}
+
+// Each task's part of a fused buffer is padded to this many bytes, so that all arrays
+// (ordered by decreasing datatype size) are packed at naturally aligned addresses
+constexpr size_t fused_alignment = sizeof( double );
+
+size_t fused_padded( size_t bytes ) {
+    return ( ( bytes + fused_alignment - 1 ) / fused_alignment ) * fused_alignment;
+}
+
 }  // namespace
 
 HaloExchange::HaloExchange() : name_(), is_setup_( false ) {
@@ -63,43 +177,42 @@ HaloExchange::~HaloExchange() = default;
 void HaloExchange::setup( const int part[], const idx_t remote_idx[], const int base, const idx_t parsize ) {
     ATLAS_TRACE( "HaloExchange::setup" );
 
-    parsize_ = parsize;
-    sendcounts_.resize( nproc );
-    sendcounts_.assign( nproc, 0 );
-    recvcounts_.resize( nproc );
-    recvcounts_.assign( nproc, 0 );
-    senddispls_.resize( nproc );
-    senddispls_.assign( nproc, 0 );
-    recvdispls_.resize( nproc );
-    recvdispls_.assign( nproc, 0 );
+    // An exchange in flight would complete with the new pattern, and its buffers would return to the pool sized
+    // for the old one
+    if ( buffers_in_use() ) {
+        throw_Exception( "HaloExchange::setup called while an exchange is in flight; wait for it first", Here() );
+    }
+    clear_buffers();
+
+    parsize_             = parsize;
+    communication_label_ = name_.empty() ? "halo-exchange" : "halo-exchange:" + name_;
 
     /*
-  Find the amount of nodes this proc has to receive from each other proc
+  Find the neighbouring procs this proc has to receive nodes from, and the
+  amount of nodes for each of them
 */
 
     IsGhostPoint is_ghost( part, remote_idx, base, parsize_ );
 
+    std::map<int, int> recv_neighbour;  // proc -> number of nodes, later index in recv_procs_
     for ( int jj = 0; jj < parsize_; ++jj ) {
         if ( is_ghost( jj ) ) {
-            ++recvcounts_[part[jj]];
+            ++recv_neighbour[part[jj]];
         }
     }
-    recvcnt_ = std::accumulate( recvcounts_.begin(), recvcounts_.end(), 0 );
-
-    /*
-  Find the amount of nodes this proc has to send to each other proc
-*/
-    ATLAS_TRACE_MPI( ALLTOALL ) { mpi::comm().allToAll( recvcounts_, sendcounts_ ); }
-
-    sendcnt_ = std::accumulate( sendcounts_.begin(), sendcounts_.end(), 0 );
 
-    recvdispls_[0] = 0;
-    senddispls_[0] = 0;
-    for ( int jproc = 1; jproc < nproc; ++jproc )  // start at 1
-    {
-        recvdispls_[jproc] = recvcounts_[jproc - 1] + recvdispls_[jproc - 1];
-        senddispls_[jproc] = sendcounts_[jproc - 1] + senddispls_[jproc - 1];
+    recv_procs_.clear();
+    recvcounts_.clear();
+    recvdispls_.clear();
+    recvcnt_ = 0;
+    for ( auto& neighbour : recv_neighbour ) {
+        recv_procs_.emplace_back( neighbour.first );
+        recvcounts_.emplace_back( neighbour.second );
+        recvdispls_.emplace_back( recvcnt_ );
+        recvcnt_ += neighbour.second;
+        neighbour.second = static_cast<int>( recv_procs_.size() ) - 1;
     }
+
     /*
   Fill vector "send_requests" with remote index of nodes needed, but are on
   other procs
@@ -110,24 +223,35 @@ void HaloExchange::setup( const int part[], const idx_t remote_idx[], const int
     std::vector<int> send_requests( recvcnt_ );
 
     recvmap_.resize( recvcnt_ );
-    std::vector<int> cnt( nproc, 0 );
+    std::vector<int> cnt( recv_procs_.size(), 0 );
     for ( int jj = 0; jj < parsize_; ++jj ) {
         if ( is_ghost( jj ) ) {
-            const int req_idx      = recvdispls_[part[jj]] + cnt[part[jj]];
+            const int jn           = recv_neighbour[part[jj]];
+            const int req_idx      = recvdispls_[jn] + cnt[jn];
             send_requests[req_idx] = remote_idx[jj] - base;
             recvmap_[req_idx]      = jj;
-            ++cnt[part[jj]];
+            ++cnt[jn];
         }
     }
 
     /*
-  Fill vector "recv_requests" with what is needed by other procs
+  Fill vector "recv_requests" with what is needed by other procs, and find
+  the procs this proc has to send to, with the amount of nodes for each
 */
 
-    std::vector<int> recv_requests( sendcnt_ );
-    ATLAS_TRACE_MPI( ALLTOALL ) {
-        mpi::comm().allToAllv( send_requests.data(), recvcounts_.data(), recvdispls_.data(), recv_requests.data(),
-                               sendcounts_.data(), senddispls_.data() );
+    std::vector<int> recv_requests;
+    if ( sparse_setup() ) {
+        exchange_requests_sparse( send_requests, recv_requests );
+    }
+    else {
+        exchange_requests_alltoall( send_requests, recv_requests );
+    }
+
+    senddispls_.resize( send_procs_.size() );
+    sendcnt_ = 0;
+    for ( size_t jn = 0; jn < send_procs_.size(); ++jn ) {
+        senddispls_[jn] = sendcnt_;
+        sendcnt_ += sendcounts_[jn];
     }
 
     /*
@@ -139,10 +263,414 @@ void HaloExchange::setup( const int part[], const idx_t remote_idx[], const int
         sendmap_[jj] = recv_requests[jj];
     }
 
+    /*
+  Only neighbouring procs take part in the exchange, so that the cost per
+  exchange scales with the number of neighbours rather than with nproc
+*/
+    std::vector<int> neighbours;
+    std::set_union( send_procs_.begin(), send_procs_.end(), recv_procs_.begin(), recv_procs_.end(),
+                    std::back_inserter( neighbours ) );
+    nb_neighbours_ = neighbours.size() - std::count( neighbours.begin(), neighbours.end(), myproc );
+
     is_setup_        = true;
     backdoor.parsize = parsize_;
 }
 
+idx_t halo_packer_omp_threshold() {
+    static idx_t threshold = eckit::Resource<long>( "$ATLAS_HALO_EXCHANGE_OMP_THRESHOLD", 16384 );
+    return threshold;
+}
+
+bool HaloExchange::sparse_setup() {
+#if ATLAS_HALO_EXCHANGE_HAVE_NBX
+    static bool sparse = eckit::Resource<bool>( "$ATLAS_HALO_EXCHANGE_SPARSE_SETUP", true );
+    return sparse;
+#else
+    return false;
+#endif
+}
+
+void HaloExchange::exchange_requests_alltoall( const std::vector<int>& send_requests,
+                                               std::vector<int>& recv_requests ) {
+    // The all-to-all needs counts and displacements for every proc
+    std::vector<int> recvcounts( nproc, 0 );
+    std::vector<int> recvdispls( nproc, 0 );
+    for ( size_t jn = 0; jn < recv_procs_.size(); ++jn ) {
+        recvcounts[recv_procs_[jn]] = recvcounts_[jn];
+        recvdispls[recv_procs_[jn]] = recvdispls_[jn];
+    }
+
+    std::vector<int> sendcounts( nproc, 0 );
+    ATLAS_TRACE_MPI( ALLTOALL ) { mpi::comm().allToAll( recvcounts, sendcounts ); }
+
+    std::vector<int> senddispls( nproc, 0 );
+    for ( int jproc = 1; jproc < nproc; ++jproc ) {
+        senddispls[jproc] = sendcounts[jproc - 1] + senddispls[jproc - 1];
+    }
+
+    recv_requests.resize( std::accumulate( sendcounts.begin(), sendcounts.end(), 0 ) );
+    ATLAS_TRACE_MPI( ALLTOALL ) {
+        mpi::comm().allToAllv( send_requests.data(), recvcounts.data(), recvdispls.data(), recv_requests.data(),
+                               sendcounts.data(), senddispls.data() );
+    }
+
+    send_procs_.clear();
+    sendcounts_.clear();
+    for ( int jproc = 0; jproc < nproc; ++jproc ) {
+        if ( sendcounts[jproc] > 0 ) {
+            send_procs_.emplace_back( jproc );
+            sendcounts_.emplace_back( sendcounts[jproc] );
+        }
+    }
+}
+
+void HaloExchange::exchange_requests_sparse( const std::vector<int>& send_requests,
+                                             std::vector<int>& recv_requests ) {
+#if ATLAS_HALO_EXCHANGE_HAVE_NBX
+    /*
+  Neighbour discovery without a collective over all procs (the "NBX" algorithm
+  of Hoefler et al., 2010). Every proc notifies the procs it requests nodes
+  from, and serves the notifications it receives itself by acknowledging them.
+  Once all of its own notifications are acknowledged, a proc enters a
+  non-blocking barrier, and keeps serving until the barrier completes on every
+  proc. Apart from the barrier, messages and storage per proc scale with the
+  number of neighbours rather than with nproc.
+*/
+    ATLAS_TRACE( "HaloExchange::setup (sparse)" );
+
+    // Consecutive setups alternate between two notification tags: a proc can get at most one setup
+    // ahead of the others, and its notifications must not match the receive still posted here.
+    const int notify_tag  = setup_notify_tag[setup_parity( mpi::comm() )];
+    const int ack_tag     = setup_ack_tag;
+    const int request_tag = setup_request_tag;
+    const int ack         = 1;
+
+    const size_t nb_recv_procs = recv_procs_.size();
+
+    std::map<int, int> requesters;  // proc -> number of nodes it requests from us
+
+    ATLAS_TRACE_MPI( SENDRECEIVE, "mpi-neighbour-discovery" ) {
+        // A notification holds the requesting proc and the number of requested nodes
+        std::array<int, 2> incoming;
+        eckit::mpi::Request incoming_req =
+            mpi::comm().iReceive( incoming.data(), incoming.size(), mpi::comm().anySource(), notify_tag );
+
+        std::vector<int> notifications( 2 * nb_recv_procs );
+        std::vector<int> acks( nb_recv_procs );
+        std::vector<eckit::mpi::Request> notify_req( nb_recv_procs );
+        std::vector<eckit::mpi::Request> ack_recv_req( nb_recv_procs );
+        std::vector<eckit::mpi::Request> ack_send_req;
+        for ( size_t jn = 0; jn < nb_recv_procs; ++jn ) {
+            notifications[2 * jn]     = myproc;
+            notifications[2 * jn + 1] = recvcounts_[jn];
+            ack_recv_req[jn]          = mpi::comm().iReceive( &acks[jn], 1, recv_procs_[jn], ack_tag );
+            notify_req[jn]            = mpi::comm().iSend( &notifications[2 * jn], 2, recv_procs_[jn], notify_tag );
+        }
+
+        std::vector<bool> acknowledged( nb_recv_procs, false );
+        size_t nb_acknowledged = 0;
+        bool in_barrier        = false;
+        eckit::mpi::Request barrier;
+        while ( true ) {
+            if ( incoming_req.test() ) {
+                requesters[incoming[0]] = incoming[1];
+                ack_send_req.emplace_back( mpi::comm().iSend( &ack, 1, incoming[0], ack_tag ) );
+                incoming_req =
+                    mpi::comm().iReceive( incoming.data(), incoming.size(), mpi::comm().anySource(), notify_tag );
+            }
+            if ( !in_barrier ) {
+                for ( size_t jn = 0; jn < nb_recv_procs; ++jn ) {
+                    if ( !acknowledged[jn] && ack_recv_req[jn].test() ) {
+                        acknowledged[jn] = true;
+                        ++nb_acknowledged;
+                    }
+                }
+                if ( nb_acknowledged == nb_recv_procs ) {
+                    barrier    = mpi::comm().iBarrier();
+                    in_barrier = true;
+                }
+            }
+            else if ( barrier.test() ) {
+                break;
+            }
+        }
+
+        // Every notification has been served, so the receive that is still posted can only
+        // match a last message to ourselves
+        const std::array<int, 2> done{{-1, 0}};
+        eckit::mpi::Request done_req = mpi::comm().iSend( done.data(), done.size(), myproc, notify_tag );
+        mpi::comm().wait( incoming_req );
+        mpi::comm().wait( done_req );
+        ATLAS_ASSERT( incoming[0] == -1 );
+
+        for ( auto& req : notify_req ) {
+            mpi::comm().wait( req );
+        }
+        for ( auto& req : ack_send_req ) {
+            mpi::comm().wait( req );
+        }
+    }
+
+    // Requesters are ordered by rank, and so are the send procs and the received requests
+    send_procs_.clear();
+    sendcounts_.clear();
+    for ( const auto& requester : requesters ) {
+        send_procs_.emplace_back( requester.first );
+        sendcounts_.emplace_back( requester.second );
+    }
+    recv_requests.resize( std::accumulate( sendcounts_.begin(), sendcounts_.end(), 0 ) );
+
+    std::vector<eckit::mpi::Request> recv_req( send_procs_.size() );
+    std::vector<eckit::mpi::Request> send_req( nb_recv_procs );
+    ATLAS_TRACE_MPI( IRECEIVE ) {
+        int displ = 0;
+        for ( size_t jn = 0; jn < send_procs_.size(); ++jn ) {
+            recv_req[jn] = mpi::comm().iReceive( recv_requests.data() + displ, sendcounts_[jn], send_procs_[jn],
+                                                 request_tag );
+            displ += sendcounts_[jn];
+        }
+    }
+    ATLAS_TRACE_MPI( ISEND ) {
+        for ( size_t jn = 0; jn < nb_recv_procs; ++jn ) {
+            send_req[jn] = mpi::comm().iSend( send_requests.data() + recvdispls_[jn], recvcounts_[jn],
+                                              recv_procs_[jn], request_tag );
+        }
+    }
+    ATLAS_TRACE_MPI( WAIT ) {
+        for ( auto& req : recv_req ) {
+            mpi::comm().wait( req );
+        }
+        for ( auto& req : send_req ) {
+            mpi::comm().wait( req );
+        }
+    }
+#else
+    throw_NotImplemented( "Sparse halo exchange setup needs a newer eckit version", Here() );
+#endif
+}
+
+void HaloExchange::execute( const std::vector<array::Array*>& arrays, WirePrecision precision ) const {
+    ATLAS_TRACE( "HaloExchange", {"halo-exchange"} );
+
+    HaloExchangeHandle handle = start( arrays, precision );
+    handle.wait();
+}
+
+HaloExchangeHandle HaloExchange::start( const std::vector<array::Array*>& arrays, WirePrecision precision ) const {
+    if ( !is_setup_ ) {
+        throw_Exception( "HaloExchange was not setup", Here() );
+    }
+
+    ATLAS_TRACE( "HaloExchange::start (fused)", {"halo-exchange"} );
+
+    // Order arrays by decreasing datatype size, so that every array is packed naturally aligned
+    std::vector<std::shared_ptr<FusedArray>> fused;
+    fused.reserve( arrays.size() );
+    for ( array::Array* array : arrays ) {
+        ATLAS_ASSERT( array->shape( 0 ) >= parsize_ );
+        fused.emplace_back( make_fused_array( *array, precision ) );
+    }
+    std::stable_sort( fused.begin(), fused.end(),
+                      []( const std::shared_ptr<FusedArray>& a, const std::shared_ptr<FusedArray>& b ) {
+                          return a->datatype_size() > b->datatype_size();
+                      } );
+
+    size_t bytes_per_point{0};
+    for ( const auto& f : fused ) {
+        bytes_per_point += f->bytes_per_point();
+    }
+
+    int tag                 = 1;
+    BuffersT<char>* buffers = &fused_buffers( bytes_per_point );
+    BuffersLease lease( *this, buffers );
+
+    ATLAS_TRACE_MPI( IRECEIVE ) {
+        /// Let MPI know what we like to receive
+        for ( size_t jn = 0; jn < recv_procs_.size(); ++jn ) {
+            buffers->recv_req[jn] = mpi::comm().iReceive( &buffers->recv_buffer[buffers->recv_displs[jn]],
+                                                          buffers->recv_counts[jn], recv_procs_[jn], tag );
+        }
+    }
+
+    /// Pack
+    ATLAS_TRACE_SCOPE( "pack_send_buffer" ) {
+        for ( size_t jn = 0; jn < send_procs_.size(); ++jn ) {
+            char* buffer    = &buffers->send_buffer[buffers->send_displs[jn]];
+            for ( const auto& f : fused ) {
+                f->pack( &sendmap_[senddispls_[jn]], sendcounts_[jn], buffer );
+                buffer += sendcounts_[jn] * f->bytes_per_point();
+            }
+        }
+    }
+
+    /// Send
+    ATLAS_TRACE_MPI( ISEND ) {
+        for ( size_t jn = 0; jn < send_procs_.size(); ++jn ) {
+            buffers->send_req[jn] = mpi::comm().iSend( &buffers->send_buffer[buffers->send_displs[jn]],
+                                                       buffers->send_counts[jn], send_procs_[jn], tag );
+        }
+    }
+    record_communication( bytes_per_point );
+
+    lease.transfer();
+    return HaloExchangeHandle( [this, buffers, fused]() {
+        BuffersLease lease( *this, buffers );
+
+        ATLAS_TRACE( "HaloExchange::wait (fused)", {"halo-exchange"} );
+
+        /// Wait for receiving to finish
+        ATLAS_TRACE_MPI( WAIT, "mpi-wait receive" ) {
+            for ( auto& request : buffers->recv_req ) {
+                mpi::comm().wait( request );
+            }
+        }
+
+        /// Unpack
+        ATLAS_TRACE_SCOPE( "unpack_recv_buffer" ) {
+            for ( size_t jn = 0; jn < recv_procs_.size(); ++jn ) {
+                char* buffer    = &buffers->recv_buffer[buffers->recv_displs[jn]];
+                for ( const auto& f : fused ) {
+                    f->unpack( &recvmap_[recvdispls_[jn]], recvcounts_[jn], buffer );
+                    buffer += recvcounts_[jn] * f->bytes_per_point();
+                }
+            }
+        }
+
+        /// Wait for sending to finish
+        ATLAS_TRACE_MPI( WAIT, "mpi-wait send" ) {
+            for ( auto& request : buffers->send_req ) {
+                mpi::comm().wait( request );
+            }
+        }
+    } );
+}
+
+void HaloExchange::record_communication( size_t bytes_per_point, bool adjoint ) const {
+    if ( !runtime::trace::Timings::communication_enabled() ) {
+        return;
+    }
+    // Messages to ourselves (periodic halos) are copies rather than communication, and are not counted
+    size_t send_messages{0};
+    size_t send_points{0};
+    for ( size_t jn = 0; jn < send_procs_.size(); ++jn ) {
+        if ( send_procs_[jn] != myproc ) {
+            ++send_messages;
+            send_points += sendcounts_[jn];
+        }
+    }
+    size_t recv_messages{0};
+    size_t recv_points{0};
+    for ( size_t jn = 0; jn < recv_procs_.size(); ++jn ) {
+        if ( recv_procs_[jn] != myproc ) {
+            ++recv_messages;
+            recv_points += recvcounts_[jn];
+        }
+    }
+
+    // The adjoint exchange sends along the reversed pattern
+    runtime::trace::Timings::Communication communication;
+    communication.count             = 1;
+    communication.messages_sent     = adjoint ? recv_messages : send_messages;
+    communication.messages_received = adjoint ? send_messages : recv_messages;
+    communication.bytes_sent        = ( adjoint ? recv_points : send_points ) * bytes_per_point;
+    communication.bytes_received    = ( adjoint ? send_points : recv_points ) * bytes_per_point;
+    communication.neighbours        = nb_neighbours_;
+    runtime::trace::Timings::update( communication_label_, communication );
+}
+
+HaloExchange::BuffersT<char>& HaloExchange::fused_buffers( size_t bytes_per_point ) const {
+    std::lock_guard<std::mutex> lock( buffers_mutex_ );
+    auto range = fused_buffers_.equal_range( bytes_per_point );
+    for ( auto it = range.first; it != range.second; ++it ) {
+        if ( !it->second->in_use ) {
+            it->second->in_use = true;
+            return static_cast<BuffersT<char>&>( *it->second );
+        }
+    }
+    ATLAS_TRACE( "HaloExchange::fused_buffers" );
+    BuffersT<char>* buffers = new BuffersT<char>();
+    buffers->send_counts.resize( send_procs_.size() );
+    buffers->send_displs.resize( send_procs_.size() );
+    buffers->recv_counts.resize( recv_procs_.size() );
+    buffers->recv_displs.resize( recv_procs_.size() );
+    buffers->send_req.resize( send_procs_.size() );
+    buffers->recv_req.resize( recv_procs_.size() );
+    int send_size{0};
+    int recv_size{0};
+    for ( size_t jn = 0; jn < send_procs_.size(); ++jn ) {
+        buffers->send_counts[jn] = fused_padded( sendcounts_[jn] * bytes_per_point );
+        buffers->send_displs[jn] = send_size;
+        send_size += buffers->send_counts[jn];
+    }
+    for ( size_t jn = 0; jn < recv_procs_.size(); ++jn ) {
+        buffers->recv_counts[jn] = fused_padded( recvcounts_[jn] * bytes_per_point );
+        buffers->recv_displs[jn] = recv_size;
+        recv_size += buffers->recv_counts[jn];
+    }
+    buffers->send_buffer.resize( send_size );
+    buffers->recv_buffer.resize( recv_size );
+    buffers->in_use = true;
+    fused_buffers_.emplace( bytes_per_point, std::unique_ptr<Buffers>( buffers ) );
+    return *buffers;
+}
+
+void HaloExchange::release_buffers( Buffers& buffers ) const {
+    std::lock_guard<std::mutex> lock( buffers_mutex_ );
+    buffers.in_use = false;
+}
+
+void HaloExchange::clear_buffers() const {
+    std::lock_guard<std::mutex> lock( buffers_mutex_ );
+    for ( auto it = buffers_.begin(); it != buffers_.end(); ) {
+        if ( it->second->in_use ) {
+            ++it;
+        }
+        else {
+            it = buffers_.erase( it );
+        }
+    }
+    for ( auto it = fused_buffers_.begin(); it != fused_buffers_.end(); ) {
+        if ( it->second->in_use ) {
+            ++it;
+        }
+        else {
+            it = fused_buffers_.erase( it );
+        }
+    }
+}
+
+bool HaloExchange::buffers_in_use() const {
+    std::lock_guard<std::mutex> lock( buffers_mutex_ );
+    for ( const auto& entry : buffers_ ) {
+        if ( entry.second->in_use ) {
+            return true;
+        }
+    }
+    for ( const auto& entry : fused_buffers_ ) {
+        if ( entry.second->in_use ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t HaloExchange::buffers_footprint() const {
+    std::lock_guard<std::mutex> lock( buffers_mutex_ );
+    size_t footprint{0};
+    for ( const auto& entry : buffers_ ) {
+        footprint += entry.second->footprint();
+    }
+    for ( const auto& entry : fused_buffers_ ) {
+        footprint += entry.second->footprint();
+    }
+    return footprint;
+}
+
+size_t HaloExchange::nb_buffers() const {
+    std::lock_guard<std::mutex> lock( buffers_mutex_ );
+    return buffers_.size() + fused_buffers_.size();
+}
+
 /////////////////////
 
 namespace {
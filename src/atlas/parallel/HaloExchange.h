@@ -13,18 +13,26 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "atlas/parallel/HaloExchangeHandle.h"
 #include "atlas/parallel/HaloExchangeImpl.h"
 #include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 
 
 #include "atlas/array/ArrayView.h"
 #include "atlas/array/ArrayViewDefs.h"
 #include "atlas/array/ArrayViewUtil.h"
+#include "atlas/array/DataType.h"
 #include "atlas/array/SVector.h"
 #include "atlas/array_fwd.h"
 #include "atlas/library/config.h"
@@ -38,6 +46,13 @@
 namespace atlas {
 namespace parallel {
 
+/// @brief Precision in which halo values are sent over MPI
+enum class WirePrecision
+{
+    Native,  ///< Values are sent in their own data type, the exchange is bit-exact
+    Single   ///< Double precision values are sent as float, and widened again on unpack
+};
+
 class HaloExchange : public util::Object {
 public:
     HaloExchange();
@@ -47,15 +62,146 @@ public:
 public:  // methods
     const std::string& name() const { return name_; }
 
+    /// @brief Compute the exchange pattern, freeing all kept-alive buffers
+    ///
+    /// Throws if an exchange started with start() has not been waited for.
     void setup( const int part[], const idx_t remote_idx[], const int base, idx_t size );
 
     //  template <typename DATA_TYPE>
     //  void execute( DATA_TYPE field[], idx_t nb_vars ) const;
 
+    /// @brief Exchange the halo of given field
+    ///
+    /// With WirePrecision::Single, double precision fields are sent as float, halving the
+    /// communicated volume at the cost of exactness. Other data types are always sent as is.
+    template <typename DATA_TYPE, int RANK, typename ParallelDim = array::FirstDim>
+    void execute( array::Array& field, bool on_device = false, WirePrecision = WirePrecision::Native ) const;
+
+    /// @brief Start a non-blocking halo exchange, to be completed with wait()
+    ///
+    /// Receives are posted and the send buffer is packed and sent before returning.
+    /// The field must stay alive, and its halo must not be accessed, until the returned
+    /// handle has been waited for. Concurrent exchanges must be started in the same
+    /// order on all MPI tasks.
     template <typename DATA_TYPE, int RANK, typename ParallelDim = array::FirstDim>
-    void execute( array::Array& field, bool on_device = false ) const;
+    HaloExchangeHandle start( array::Array& field, bool on_device = false,
+                              WirePrecision = WirePrecision::Native ) const;
+
+    /// @brief Complete a halo exchange that was started with start()
+    void wait( HaloExchangeHandle& handle ) const { handle.wait(); }
+
+    /// @brief Adjoint of execute(): accumulate halo values into the points they are copies of
+    ///
+    /// Communication follows the send/recv maps of execute() in reverse: the values of halo
+    /// points are sent back to their owners and added to the owned values. Afterwards the
+    /// halo points are set to zero. Only host memory is supported.
+    template <typename DATA_TYPE, int RANK, typename ParallelDim = array::FirstDim>
+    void execute_adjoint( array::Array& field, bool on_device = false ) const;
+
+    /// @brief Exchange the halos of multiple arrays at once, with a single message per neighbouring task
+    ///
+    /// The arrays may differ in data type (int, long, float, double), rank (1 to 4) and shape,
+    /// but for all of them the first dimension must be the parallel dimension of this HaloExchange.
+    /// Only host memory is exchanged.
+    void execute( const std::vector<array::Array*>& arrays, WirePrecision = WirePrecision::Native ) const;
+
+    /// @brief Start a non-blocking exchange of multiple arrays, see execute( const std::vector<array::Array*>& )
+    HaloExchangeHandle start( const std::vector<array::Array*>& arrays, WirePrecision = WirePrecision::Native ) const;
+
+    /// @brief Free the send/recv buffers that are kept alive between calls to execute()
+    ///
+    /// Buffers are allocated on first use for every combination of data type and
+    /// number of variables per point, and reused by subsequent exchanges.
+    /// Buffers of exchanges that are still in flight are not freed.
+    void clear_buffers() const;
+
+    /// @brief Memory footprint in bytes of the buffers currently kept alive
+    size_t buffers_footprint() const;
+
+    /// @brief Number of sets of send/recv buffers currently kept alive
+    ///
+    /// Only exchanges that are in flight at the same time need distinct buffers,
+    /// so this stays constant for a repeated sequence of exchanges.
+    size_t nb_buffers() const;
+
+private:  // types
+    /// Buffers, counts, displacements and requests for one exchange.
+    /// Counts, displacements and requests are indexed by neighbour, see send_procs_ and recv_procs_
+    struct Buffers {
+        virtual ~Buffers() = default;
+        virtual size_t footprint() const = 0;
+        std::vector<int> send_counts;
+        std::vector<int> send_displs;
+        std::vector<int> recv_counts;
+        std::vector<int> recv_displs;
+        std::vector<eckit::mpi::Request> send_req;
+        std::vector<eckit::mpi::Request> recv_req;
+        bool in_use{false};  ///< Leased by an exchange, see BuffersLease
+
+        // Field of the exchange in flight, to be unpacked when it completes
+        array::Array* field{nullptr};
+        bool on_device{false};
+    };
+
+    template <typename DATA_TYPE>
+    struct BuffersT : Buffers {
+        size_t footprint() const override { return send_buffer.footprint() + recv_buffer.footprint(); }
+        array::SVector<DATA_TYPE> send_buffer;
+        array::SVector<DATA_TYPE> recv_buffer;
+    };
+
+    using BuffersKey = std::pair<array::DataType::kind_t, idx_t>;
+
+    /// Exclusive use of Buffers taken from the pool, which are returned to the pool when
+    /// the lease is destroyed, also when an exception is thrown.
+    class BuffersLease {
+    public:
+        BuffersLease( const HaloExchange& halo_exchange, Buffers* buffers ) :
+            halo_exchange_( halo_exchange ),
+            buffers_( buffers ) {}
+        BuffersLease( const BuffersLease& ) = delete;
+        BuffersLease& operator=( const BuffersLease& ) = delete;
+        ~BuffersLease() {
+            if ( buffers_ ) {
+                halo_exchange_.release_buffers( *buffers_ );
+            }
+        }
+        /// Hand the buffers over to an exchange in flight, which takes a new lease when it completes
+        void transfer() { buffers_ = nullptr; }
+
+    private:
+        const HaloExchange& halo_exchange_;
+        Buffers* buffers_;
+    };
 
 private:  // methods
+    template <typename DATA_TYPE, typename BUFFER_TYPE, int RANK, typename ParallelDim>
+    HaloExchangeHandle start_impl( array::Array& field, bool on_device ) const;
+
+    template <typename DATA_TYPE, typename BUFFER_TYPE, int RANK, typename ParallelDim>
+    void wait_impl( BuffersT<BUFFER_TYPE>& buffers ) const;
+
+    /// Unused buffers from the pool, or newly allocated ones. The caller takes a BuffersLease on them.
+    template <typename DATA_TYPE>
+    BuffersT<DATA_TYPE>& buffers( idx_t var_size ) const;
+
+    BuffersT<char>& fused_buffers( size_t bytes_per_point ) const;
+
+    void release_buffers( Buffers& ) const;
+
+    /// Whether any buffers of the pool are leased by an exchange in flight
+    bool buffers_in_use() const;
+
+    /// @brief Whether setup exchanges requests only between neighbouring tasks
+    /// (default), rather than with an all-to-all over every task.
+    /// Controlled by environment variable ATLAS_HALO_EXCHANGE_SPARSE_SETUP.
+    /// Always false when eckit lacks non-blocking barriers (eckit < 1.20).
+    static bool sparse_setup();
+
+    void exchange_requests_alltoall( const std::vector<int>& send_requests, std::vector<int>& recv_requests );
+
+    void exchange_requests_sparse( const std::vector<int>& send_requests, std::vector<int>& recv_requests );
+
     void create_mappings( std::vector<int>& send_map, std::vector<int>& recv_map, idx_t nb_vars ) const;
 
     template <int N, int P>
@@ -75,76 +221,124 @@ private:  // methods
                              const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadOnly>& hfield,
                              array::ArrayView<DATA_TYPE, RANK>& dfield, const bool on_device ) const;
 
+    // Overloads for a buffer type different from the field's data type (host only)
+    template <int ParallelDim, typename DATA_TYPE, typename BUFFER_TYPE, int RANK>
+    void pack_send_buffer( const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadOnly>& hfield,
+                           const array::ArrayView<DATA_TYPE, RANK>& dfield, array::SVector<BUFFER_TYPE>& send_buffer,
+                           const bool on_device ) const;
+
+    template <int ParallelDim, typename DATA_TYPE, typename BUFFER_TYPE, int RANK>
+    void unpack_recv_buffer( const array::SVector<BUFFER_TYPE>& recv_buffer,
+                             const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadOnly>& hfield,
+                             array::ArrayView<DATA_TYPE, RANK>& dfield, const bool on_device ) const;
+
     template <typename DATA_TYPE, int RANK>
     void var_info( const array::ArrayView<DATA_TYPE, RANK>& arr, std::vector<idx_t>& varstrides,
                    std::vector<idx_t>& varshape ) const;
 
+    /// @brief Record the communication volume of one exchange in runtime::trace::Timings,
+    /// under communication_label_
+    void record_communication( size_t bytes_per_point, bool adjoint = false ) const;
+
 private:  // data
     std::string name_;
+    std::string communication_label_;  ///< "halo-exchange:<name>", or "halo-exchange" when unnamed
     bool is_setup_;
 
     int sendcnt_;
     int recvcnt_;
-    std::vector<int> sendcounts_;
-    std::vector<int> senddispls_;
-    std::vector<int> recvcounts_;
-    std::vector<int> recvdispls_;
+    std::vector<int> sendcounts_;  ///< Number of points sent to each of send_procs_
+    std::vector<int> senddispls_;  ///< Offset in sendmap_ of each of send_procs_
+    std::vector<int> recvcounts_;  ///< Number of points received from each of recv_procs_
+    std::vector<int> recvdispls_;  ///< Offset in recvmap_ of each of recv_procs_
     array::SVector<int> sendmap_;
     array::SVector<int> recvmap_;
     int parsize_;
 
+    std::vector<int> send_procs_;  ///< Neighbouring tasks that we send to, in ascending order
+    std::vector<int> recv_procs_;  ///< Neighbouring tasks that we receive from, in ascending order
+    size_t nb_neighbours_;         ///< Number of other tasks in send_procs_ and recv_procs_
+
     int nproc;
     int myproc;
 
+    // Pools of buffers, guarded by buffers_mutex_ so that exchanges may be started from multiple threads
+    mutable std::multimap<BuffersKey, std::unique_ptr<Buffers>> buffers_;
+    mutable std::multimap<size_t, std::unique_ptr<Buffers>> fused_buffers_;
+    mutable std::mutex buffers_mutex_;
+
 public:
     struct Backdoor {
         int parsize;
     } backdoor;
 };
 
+/// Data type in which DATA_TYPE is sent with WirePrecision::Single
+template <typename DATA_TYPE>
+struct single_precision_wire {
+    using type = DATA_TYPE;
+};
+template <>
+struct single_precision_wire<double> {
+    using type = float;
+};
+
+template <typename DATA_TYPE, int RANK, typename ParallelDim>
+void HaloExchange::execute( array::Array& field, bool on_device, WirePrecision precision ) const {
+    ATLAS_TRACE( "HaloExchange", {"halo-exchange"} );
+
+    HaloExchangeHandle handle = start<DATA_TYPE, RANK, ParallelDim>( field, on_device, precision );
+    handle.wait();
+}
+
 template <typename DATA_TYPE, int RANK, typename ParallelDim>
-void HaloExchange::execute( array::Array& field, bool on_device ) const {
+HaloExchangeHandle HaloExchange::start( array::Array& field, bool on_device, WirePrecision precision ) const {
+    using wire_type = typename single_precision_wire<DATA_TYPE>::type;
+    if ( precision == WirePrecision::Single && !std::is_same<wire_type, DATA_TYPE>::value ) {
+        if ( on_device ) {
+            throw_NotImplemented( "Single precision halo exchange of device data", Here() );
+        }
+        return start_impl<DATA_TYPE, wire_type, RANK, ParallelDim>( field, on_device );
+    }
+    return start_impl<DATA_TYPE, DATA_TYPE, RANK, ParallelDim>( field, on_device );
+}
+
+template <typename DATA_TYPE, typename BUFFER_TYPE, int RANK, typename ParallelDim>
+HaloExchangeHandle HaloExchange::start_impl( array::Array& field, bool on_device ) const {
     if ( !is_setup_ ) {
         throw_Exception( "HaloExchange was not setup", Here() );
     }
 
-    ATLAS_TRACE( "HaloExchange", {"halo-exchange"} );
+    ATLAS_TRACE( "HaloExchange::start", {"halo-exchange"} );
 
     auto field_hv = array::make_host_view<DATA_TYPE, RANK, array::Intent::ReadOnly>( field );
 
     int tag                   = 1;
     constexpr int parallelDim = array::get_parallel_dim<ParallelDim>( field_hv );
     idx_t var_size            = array::get_var_size<parallelDim>( field_hv );
-    int send_size             = sendcnt_ * var_size;
-    int recv_size             = recvcnt_ * var_size;
-
-    array::SVector<DATA_TYPE> send_buffer( send_size );
-    array::SVector<DATA_TYPE> recv_buffer( recv_size );
-    std::vector<int> send_displs( nproc );
-    std::vector<int> recv_displs( nproc );
-    std::vector<int> send_counts( nproc );
-    std::vector<int> recv_counts( nproc );
-
-    std::vector<eckit::mpi::Request> send_req( nproc );
-    std::vector<eckit::mpi::Request> recv_req( nproc );
-
-    for ( int jproc = 0; jproc < nproc; ++jproc ) {
-        send_counts[jproc] = sendcounts_[jproc] * var_size;
-        recv_counts[jproc] = recvcounts_[jproc] * var_size;
-        send_displs[jproc] = senddispls_[jproc] * var_size;
-        recv_displs[jproc] = recvdispls_[jproc] * var_size;
-    }
+
+    BuffersT<BUFFER_TYPE>* buffers = &this->buffers<BUFFER_TYPE>( var_size );
+    BuffersLease lease( *this, buffers );
+    buffers->field     = &field;
+    buffers->on_device = on_device;
+
+    array::SVector<BUFFER_TYPE>& send_buffer   = buffers->send_buffer;
+    array::SVector<BUFFER_TYPE>& recv_buffer   = buffers->recv_buffer;
+    const std::vector<int>& send_displs        = buffers->send_displs;
+    const std::vector<int>& recv_displs        = buffers->recv_displs;
+    const std::vector<int>& send_counts        = buffers->send_counts;
+    const std::vector<int>& recv_counts        = buffers->recv_counts;
+    std::vector<eckit::mpi::Request>& send_req = buffers->send_req;
+    std::vector<eckit::mpi::Request>& recv_req = buffers->recv_req;
 
     auto field_dv =
         on_device ? array::make_device_view<DATA_TYPE, RANK>( field ) : array::make_host_view<DATA_TYPE, RANK>( field );
 
     ATLAS_TRACE_MPI( IRECEIVE ) {
         /// Let MPI know what we like to receive
-        for ( int jproc = 0; jproc < nproc; ++jproc ) {
-            if ( recv_counts[jproc] > 0 ) {
-                recv_req[jproc] =
-                    mpi::comm().iReceive( &recv_buffer[recv_displs[jproc]], recv_counts[jproc], jproc, tag );
-            }
+        for ( size_t jn = 0; jn < recv_procs_.size(); ++jn ) {
+            recv_req[jn] =
+                mpi::comm().iReceive( &recv_buffer[recv_displs[jn]], recv_counts[jn], recv_procs_[jn], tag );
         }
     }
 
@@ -153,55 +347,213 @@ void HaloExchange::execute( array::Array& field, bool on_device ) const {
 
     /// Send
     ATLAS_TRACE_MPI( ISEND ) {
-        for ( int jproc = 0; jproc < nproc; ++jproc ) {
-            if ( send_counts[jproc] > 0 ) {
-                send_req[jproc] = mpi::comm().iSend( &send_buffer[send_displs[jproc]], send_counts[jproc], jproc, tag );
-            }
+        for ( size_t jn = 0; jn < send_procs_.size(); ++jn ) {
+            send_req[jn] = mpi::comm().iSend( &send_buffer[send_displs[jn]], send_counts[jn], send_procs_[jn], tag );
         }
     }
+    record_communication( var_size * sizeof( BUFFER_TYPE ) );
+
+    // Only two pointers are captured, which std::function stores without allocating
+    lease.transfer();
+    return HaloExchangeHandle(
+        [this, buffers]() { wait_impl<DATA_TYPE, BUFFER_TYPE, RANK, ParallelDim>( *buffers ); } );
+}
+
+template <typename DATA_TYPE, typename BUFFER_TYPE, int RANK, typename ParallelDim>
+void HaloExchange::wait_impl( BuffersT<BUFFER_TYPE>& buffers ) const {
+    BuffersLease lease( *this, &buffers );
+
+    ATLAS_TRACE( "HaloExchange::wait", {"halo-exchange"} );
+
+    auto field_hv = array::make_host_view<DATA_TYPE, RANK, array::Intent::ReadOnly>( *buffers.field );
+    auto field_dv = buffers.on_device ? array::make_device_view<DATA_TYPE, RANK>( *buffers.field )
+                                      : array::make_host_view<DATA_TYPE, RANK>( *buffers.field );
+    constexpr int parallelDim = array::get_parallel_dim<ParallelDim>( field_hv );
 
     /// Wait for receiving to finish
     ATLAS_TRACE_MPI( WAIT, "mpi-wait receive" ) {
-        for ( int jproc = 0; jproc < nproc; ++jproc ) {
-            if ( recvcounts_[jproc] > 0 ) {
-                mpi::comm().wait( recv_req[jproc] );
-            }
+        for ( auto& request : buffers.recv_req ) {
+            mpi::comm().wait( request );
         }
     }
 
     /// Unpack
-    unpack_recv_buffer<parallelDim>( recv_buffer, field_hv, field_dv, on_device );
+    unpack_recv_buffer<parallelDim>( buffers.recv_buffer, field_hv, field_dv, buffers.on_device );
 
     /// Wait for sending to finish
     ATLAS_TRACE_MPI( WAIT, "mpi-wait send" ) {
-        for ( int jproc = 0; jproc < nproc; ++jproc ) {
-            if ( sendcounts_[jproc] > 0 ) {
-                mpi::comm().wait( send_req[jproc] );
-            }
+        for ( auto& request : buffers.send_req ) {
+            mpi::comm().wait( request );
         }
     }
+
+    buffers.field = nullptr;
+}
+
+template <typename DATA_TYPE>
+HaloExchange::BuffersT<DATA_TYPE>& HaloExchange::buffers( idx_t var_size ) const {
+    std::lock_guard<std::mutex> lock( buffers_mutex_ );
+    const BuffersKey key( array::DataType::kind<DATA_TYPE>(), var_size );
+    auto range = buffers_.equal_range( key );
+    for ( auto it = range.first; it != range.second; ++it ) {
+        if ( !it->second->in_use ) {
+            it->second->in_use = true;
+            return static_cast<BuffersT<DATA_TYPE>&>( *it->second );
+        }
+    }
+    ATLAS_TRACE( "HaloExchange::buffers" );
+    BuffersT<DATA_TYPE>* buffers = new BuffersT<DATA_TYPE>();
+    buffers->send_buffer.resize( sendcnt_ * var_size );
+    buffers->recv_buffer.resize( recvcnt_ * var_size );
+    buffers->send_counts.resize( send_procs_.size() );
+    buffers->send_displs.resize( send_procs_.size() );
+    buffers->recv_counts.resize( recv_procs_.size() );
+    buffers->recv_displs.resize( recv_procs_.size() );
+    buffers->send_req.resize( send_procs_.size() );
+    buffers->recv_req.resize( recv_procs_.size() );
+    for ( size_t jn = 0; jn < send_procs_.size(); ++jn ) {
+        buffers->send_counts[jn] = sendcounts_[jn] * var_size;
+        buffers->send_displs[jn] = senddispls_[jn] * var_size;
+    }
+    for ( size_t jn = 0; jn < recv_procs_.size(); ++jn ) {
+        buffers->recv_counts[jn] = recvcounts_[jn] * var_size;
+        buffers->recv_displs[jn] = recvdispls_[jn] * var_size;
+    }
+    buffers->in_use = true;
+    buffers_.emplace( key, std::unique_ptr<Buffers>( buffers ) );
+    return *buffers;
 }
 
+/// @brief Number of values packed or unpacked per halo exchange, below which halo_packer stays serial.
+/// Controlled by environment variable ATLAS_HALO_EXCHANGE_OMP_THRESHOLD.
+idx_t halo_packer_omp_threshold();
+
+/// @brief Packing and unpacking of the values belonging to a single point.
+/// When the parallel dimension is the first one and the view is contiguous, all levels/variables of
+/// a point are adjacent in memory, and are copied with a plain (vectorisable) loop.
+template <int ParallelDim, int RANK>
+struct halo_packer_point {
+    template <typename DATA_TYPE, typename BUFFER_TYPE>
+    static void pack( idx_t ibuf, const idx_t node_idx, const idx_t,
+                      const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadWrite>& field,
+                      array::SVector<BUFFER_TYPE>& send_buffer ) {
+        halo_packer_impl<ParallelDim, RANK, 0>::apply( ibuf, node_idx, field, send_buffer );
+    }
+
+    template <typename Op, typename DATA_TYPE, typename BUFFER_TYPE>
+    static void unpack( idx_t ibuf, const idx_t node_idx, const idx_t, array::SVector<BUFFER_TYPE> const& recv_buffer,
+                        array::ArrayView<DATA_TYPE, RANK>& field ) {
+        halo_unpacker_impl<ParallelDim, RANK, 0, Op>::apply( ibuf, node_idx, recv_buffer, field );
+    }
+};
+
+template <int RANK>
+struct halo_packer_point<0, RANK> {
+    template <typename DATA_TYPE, array::Intent AccessMode>
+    static bool contiguous( const array::ArrayView<DATA_TYPE, RANK, AccessMode>& field ) {
+        idx_t stride = 1;
+        for ( int j = RANK - 1; j >= 0; --j ) {
+            if ( field.shape( j ) > 1 && field.stride( j ) != stride ) {
+                return false;
+            }
+            stride *= field.shape( j );
+        }
+        return true;
+    }
+
+    template <typename DATA_TYPE, typename BUFFER_TYPE>
+    static void pack( idx_t ibuf, const idx_t node_idx, const idx_t var_size,
+                      const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadWrite>& field,
+                      array::SVector<BUFFER_TYPE>& send_buffer ) {
+        const DATA_TYPE* src = field.data() + node_idx * field.stride( 0 );
+        BUFFER_TYPE* dst     = send_buffer.data() + ibuf;
+        for ( idx_t jvar = 0; jvar < var_size; ++jvar ) {
+            dst[jvar] = static_cast<BUFFER_TYPE>( src[jvar] );
+        }
+    }
+
+    template <typename Op, typename DATA_TYPE, typename BUFFER_TYPE>
+    static void unpack( idx_t ibuf, const idx_t node_idx, const idx_t var_size,
+                        array::SVector<BUFFER_TYPE> const& recv_buffer, array::ArrayView<DATA_TYPE, RANK>& field ) {
+        const BUFFER_TYPE* src = recv_buffer.data() + ibuf;
+        DATA_TYPE* dst         = field.data() + node_idx * field.stride( 0 );
+        for ( idx_t jvar = 0; jvar < var_size; ++jvar ) {
+            Op::apply( dst[jvar], src[jvar] );
+        }
+    }
+};
+
 template <int ParallelDim, int RANK>
 struct halo_packer {
-    template <typename DATA_TYPE>
+    /// Number of values per point, i.e. the product of all extents but the parallel one
+    template <typename DATA_TYPE, array::Intent AccessMode>
+    static idx_t var_size( const array::ArrayView<DATA_TYPE, RANK, AccessMode>& field ) {
+        idx_t size = 1;
+        for ( int j = 0; j < RANK; ++j ) {
+            if ( j != ParallelDim ) {
+                size *= field.shape( j );
+            }
+        }
+        return size;
+    }
+
+    template <typename DATA_TYPE, typename BUFFER_TYPE>
     static void pack( const int sendcnt, array::SVector<int> const& sendmap,
                       const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadWrite>& field,
-                      array::SVector<DATA_TYPE>& send_buffer ) {
-        idx_t ibuf = 0;
-        for ( int node_cnt = 0; node_cnt < sendcnt; ++node_cnt ) {
-            const idx_t node_idx = sendmap[node_cnt];
-            halo_packer_impl<ParallelDim, RANK, 0>::apply( ibuf, node_idx, field, send_buffer );
+                      array::SVector<BUFFER_TYPE>& send_buffer ) {
+        const idx_t nvar = var_size( field );
+        if ( ParallelDim == 0 && halo_packer_point<0, RANK>::contiguous( field ) ) {
+            apply_pack<halo_packer_point<0, RANK>>( sendcnt, sendmap, nvar, field, send_buffer );
+        }
+        else {
+            apply_pack<halo_packer_point<ParallelDim, RANK>>( sendcnt, sendmap, nvar, field, send_buffer );
         }
     }
 
-    template <typename DATA_TYPE>
+    /// Op determines how received values are combined with the field, see halo_assign, halo_add, halo_zero
+    template <typename Op = halo_assign, typename DATA_TYPE, typename BUFFER_TYPE>
     static void unpack( const int recvcnt, array::SVector<int> const& recvmap,
-                        array::SVector<DATA_TYPE> const& recv_buffer, array::ArrayView<DATA_TYPE, RANK>& field ) {
-        idx_t ibuf = 0;
-        for ( int node_cnt = 0; node_cnt < recvcnt; ++node_cnt ) {
-            const idx_t node_idx = recvmap[node_cnt];
-            halo_unpacker_impl<ParallelDim, RANK, 0>::apply( ibuf, node_idx, recv_buffer, field );
+                        array::SVector<BUFFER_TYPE> const& recv_buffer, array::ArrayView<DATA_TYPE, RANK>& field ) {
+        const idx_t nvar = var_size( field );
+        if ( ParallelDim == 0 && halo_packer_point<0, RANK>::contiguous( field ) ) {
+            apply_unpack<halo_packer_point<0, RANK>, Op>( recvcnt, recvmap, nvar, recv_buffer, field );
+        }
+        else {
+            apply_unpack<halo_packer_point<ParallelDim, RANK>, Op>( recvcnt, recvmap, nvar, recv_buffer, field );
+        }
+    }
+
+private:
+    // Every point occupies nvar consecutive values in the buffer, so points can be (un)packed independently,
+    // by multiple threads when there is enough work.
+    template <typename Point, typename DATA_TYPE, typename BUFFER_TYPE>
+    static void apply_pack( const int sendcnt, array::SVector<int> const& sendmap, const idx_t nvar,
+                            const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadWrite>& field,
+                            array::SVector<BUFFER_TYPE>& send_buffer ) {
+        if ( sendcnt * nvar < halo_packer_omp_threshold() ) {
+            for ( int node_cnt = 0; node_cnt < sendcnt; ++node_cnt ) {
+                Point::pack( node_cnt * nvar, sendmap[node_cnt], nvar, field, send_buffer );
+            }
+        }
+        else {
+            atlas_omp_parallel_for( int node_cnt = 0; node_cnt < sendcnt; ++node_cnt ) {
+                Point::pack( node_cnt * nvar, sendmap[node_cnt], nvar, field, send_buffer );
+            }
+        }
+    }
+
+    template <typename Point, typename Op, typename DATA_TYPE, typename BUFFER_TYPE>
+    static void apply_unpack( const int recvcnt, array::SVector<int> const& recvmap, const idx_t nvar,
+                              array::SVector<BUFFER_TYPE> const& recv_buffer, array::ArrayView<DATA_TYPE, RANK>& field ) {
+        if ( !Op::thread_safe || recvcnt * nvar < halo_packer_omp_threshold() ) {
+            for ( int node_cnt = 0; node_cnt < recvcnt; ++node_cnt ) {
+                Point::template unpack<Op>( node_cnt * nvar, recvmap[node_cnt], nvar, recv_buffer, field );
+            }
+        }
+        else {
+            atlas_omp_parallel_for( int node_cnt = 0; node_cnt < recvcnt; ++node_cnt ) {
+                Point::template unpack<Op>( node_cnt * nvar, recvmap[node_cnt], nvar, recv_buffer, field );
+            }
         }
     }
 };
@@ -234,6 +586,84 @@ void HaloExchange::unpack_recv_buffer( const array::SVector<DATA_TYPE>& recv_buf
         halo_packer<ParallelDim, RANK>::unpack( recvcnt_, recvmap_, recv_buffer, dfield );
 }
 
+template <int ParallelDim, typename DATA_TYPE, typename BUFFER_TYPE, int RANK>
+void HaloExchange::pack_send_buffer( const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadOnly>&,
+                                     const array::ArrayView<DATA_TYPE, RANK>& dfield,
+                                     array::SVector<BUFFER_TYPE>& send_buffer, const bool on_device ) const {
+    ATLAS_TRACE();
+    ATLAS_ASSERT( !on_device );
+    halo_packer<ParallelDim, RANK>::pack( sendcnt_, sendmap_, dfield, send_buffer );
+}
+
+template <int ParallelDim, typename DATA_TYPE, typename BUFFER_TYPE, int RANK>
+void HaloExchange::unpack_recv_buffer( const array::SVector<BUFFER_TYPE>& recv_buffer,
+                                       const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadOnly>&,
+                                       array::ArrayView<DATA_TYPE, RANK>& dfield, const bool on_device ) const {
+    ATLAS_TRACE();
+    ATLAS_ASSERT( !on_device );
+    halo_packer<ParallelDim, RANK>::unpack( recvcnt_, recvmap_, recv_buffer, dfield );
+}
+
+template <typename DATA_TYPE, int RANK, typename ParallelDim>
+void HaloExchange::execute_adjoint( array::Array& field, bool on_device ) const {
+    if ( !is_setup_ ) {
+        throw_Exception( "HaloExchange was not setup", Here() );
+    }
+    if ( on_device ) {
+        throw_NotImplemented( "Adjoint halo exchange of device data", Here() );
+    }
+
+    ATLAS_TRACE( "HaloExchange::execute_adjoint", {"halo-exchange"} );
+
+    auto field_hv = array::make_host_view<DATA_TYPE, RANK>( field );
+
+    int tag                   = 3;
+    constexpr int parallelDim = array::get_parallel_dim<ParallelDim>( field_hv );
+    idx_t var_size            = array::get_var_size<parallelDim>( field_hv );
+
+    // Roles of the buffers are swapped with respect to execute():
+    // halo values travel in recv_buffer, and contributions to owned values arrive in send_buffer
+    BuffersT<DATA_TYPE>& buffers = this->buffers<DATA_TYPE>( var_size );
+    BuffersLease lease( *this, &buffers );
+
+    array::SVector<DATA_TYPE>& send_buffer = buffers.send_buffer;
+    array::SVector<DATA_TYPE>& recv_buffer = buffers.recv_buffer;
+
+    ATLAS_TRACE_MPI( IRECEIVE ) {
+        for ( size_t jn = 0; jn < send_procs_.size(); ++jn ) {
+            buffers.send_req[jn] = mpi::comm().iReceive( &send_buffer[buffers.send_displs[jn]],
+                                                         buffers.send_counts[jn], send_procs_[jn], tag );
+        }
+    }
+
+    /// Pack halo values, and reset them as they now belong to their owners
+    halo_packer<parallelDim, RANK>::pack( recvcnt_, recvmap_, field_hv, recv_buffer );
+    halo_packer<parallelDim, RANK>::template unpack<halo_zero>( recvcnt_, recvmap_, recv_buffer, field_hv );
+
+    ATLAS_TRACE_MPI( ISEND ) {
+        for ( size_t jn = 0; jn < recv_procs_.size(); ++jn ) {
+            buffers.recv_req[jn] = mpi::comm().iSend( &recv_buffer[buffers.recv_displs[jn]],
+                                                      buffers.recv_counts[jn], recv_procs_[jn], tag );
+        }
+    }
+    record_communication( var_size * sizeof( DATA_TYPE ), true );
+
+    ATLAS_TRACE_MPI( WAIT, "mpi-wait receive" ) {
+        for ( auto& request : buffers.send_req ) {
+            mpi::comm().wait( request );
+        }
+    }
+
+    /// Accumulate contributions into owned values
+    halo_packer<parallelDim, RANK>::template unpack<halo_add>( sendcnt_, sendmap_, send_buffer, field_hv );
+
+    ATLAS_TRACE_MPI( WAIT, "mpi-wait send" ) {
+        for ( auto& request : buffers.recv_req ) {
+            mpi::comm().wait( request );
+        }
+    }
+}
+
 // template<typename DATA_TYPE>
 // void HaloExchange::execute( DATA_TYPE field[], idx_t nb_vars ) const
 //{
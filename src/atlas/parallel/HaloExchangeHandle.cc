@@ -0,0 +1,81 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <utility>
+
+#include "atlas/parallel/HaloExchangeHandle.h"
+
+namespace atlas {
+namespace parallel {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+HaloExchangeHandle::HaloExchangeHandle( std::function<void()>&& wait ) : wait_( std::move( wait ) ) {}
+
+HaloExchangeHandle::HaloExchangeHandle( HaloExchangeHandle&& other ) :
+    wait_( std::move( other.wait_ ) ),
+    next_( std::move( other.next_ ) ) {
+    other.wait_ = nullptr;
+    other.next_.clear();
+}
+
+HaloExchangeHandle& HaloExchangeHandle::operator=( HaloExchangeHandle&& other ) {
+    if ( this != &other ) {
+        wait();
+        wait_       = std::move( other.wait_ );
+        next_       = std::move( other.next_ );
+        other.wait_ = nullptr;
+        other.next_.clear();
+    }
+    return *this;
+}
+
+HaloExchangeHandle::~HaloExchangeHandle() {
+    wait();
+}
+
+void HaloExchangeHandle::wait() {
+    std::function<void()> wait;
+    std::vector<std::function<void()>> next;
+    wait.swap( wait_ );
+    next.swap( next_ );
+    if ( wait ) {
+        wait();
+    }
+    for ( auto& w : next ) {
+        w();
+    }
+}
+
+void HaloExchangeHandle::append( HaloExchangeHandle&& other ) {
+    append( std::move( other.wait_ ) );
+    for ( auto& w : other.next_ ) {
+        append( std::move( w ) );
+    }
+    other.wait_ = nullptr;
+    other.next_.clear();
+}
+
+void HaloExchangeHandle::append( std::function<void()>&& wait ) {
+    if ( !wait ) {
+        return;
+    }
+    if ( !wait_ ) {
+        wait_ = std::move( wait );
+    }
+    else {
+        next_.emplace_back( std::move( wait ) );
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+}  // namespace parallel
+}  // namespace atlas
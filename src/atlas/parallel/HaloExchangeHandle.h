@@ -0,0 +1,60 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+namespace atlas {
+namespace parallel {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+/// @brief Handle to a halo exchange that has been started, but not yet completed
+///
+/// A handle is returned by the split-phase "start" variants of the halo exchange
+/// (parallel::HaloExchange::start, Field::haloExchangeStart, FieldSet::haloExchangeStart, ...).
+/// Messages are in flight while the handle is active, and halo values may only be used
+/// after wait() returns. Owned (non-halo) values can be read and updated in the meantime.
+///
+/// A handle that is still active upon destruction is completed in its destructor.
+class HaloExchangeHandle {
+public:
+    HaloExchangeHandle() = default;
+    HaloExchangeHandle( std::function<void()>&& wait );
+    HaloExchangeHandle( HaloExchangeHandle&& );
+    HaloExchangeHandle& operator=( HaloExchangeHandle&& );
+    HaloExchangeHandle( const HaloExchangeHandle& ) = delete;
+    HaloExchangeHandle& operator=( const HaloExchangeHandle& ) = delete;
+    ~HaloExchangeHandle();
+
+    /// @brief Complete the exchange: wait for all messages and unpack the received halo values
+    void wait();
+
+    /// @brief True if the exchange has been started and wait() has not yet been called
+    bool active() const { return bool( wait_ ); }
+
+    /// @brief Take over the pending exchanges of other handle, to be completed by this handle's wait()
+    void append( HaloExchangeHandle&& other );
+
+    /// @brief Append a completion step, executed at wait() after all previously added steps
+    void append( std::function<void()>&& wait );
+
+private:
+    // The first completion step is kept apart, so that a handle of a single exchange allocates no vector
+    std::function<void()> wait_;
+    std::vector<std::function<void()>> next_;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+}  // namespace parallel
+}  // namespace atlas
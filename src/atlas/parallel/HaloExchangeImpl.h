@@ -18,10 +18,10 @@ namespace parallel {
 
 template <int ParallelDim, int Cnt, int CurrentDim>
 struct halo_packer_impl {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
+    template <typename DATA_TYPE, typename BUFFER_TYPE, int RANK, typename... Idx>
     ATLAS_HOST_DEVICE static void apply( idx_t& buf_idx, const idx_t node_idx,
                                          const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadWrite>& field,
-                                         array::SVector<DATA_TYPE>& send_buffer, Idx... idxs ) {
+                                         array::SVector<BUFFER_TYPE>& send_buffer, Idx... idxs ) {
         for ( idx_t i = 0; i < field.template shape<CurrentDim>(); ++i ) {
             halo_packer_impl<ParallelDim, Cnt - 1, CurrentDim + 1>::apply( buf_idx, node_idx, field, send_buffer,
                                                                            idxs..., i );
@@ -31,20 +31,20 @@ struct halo_packer_impl {
 
 template <int ParallelDim>
 struct halo_packer_impl<ParallelDim, 0, ParallelDim> {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
+    template <typename DATA_TYPE, typename BUFFER_TYPE, int RANK, typename... Idx>
     ATLAS_HOST_DEVICE static void apply( idx_t& buf_idx, const idx_t node_idx,
                                          const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadWrite>& field,
-                                         array::SVector<DATA_TYPE>& send_buffer, Idx... idxs ) {
-        send_buffer[buf_idx++] = field( idxs... );
+                                         array::SVector<BUFFER_TYPE>& send_buffer, Idx... idxs ) {
+        send_buffer[buf_idx++] = static_cast<BUFFER_TYPE>( field( idxs... ) );
     }
 };
 
 template <int ParallelDim, int Cnt>
 struct halo_packer_impl<ParallelDim, Cnt, ParallelDim> {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
+    template <typename DATA_TYPE, typename BUFFER_TYPE, int RANK, typename... Idx>
     ATLAS_HOST_DEVICE static void apply( idx_t& buf_idx, const idx_t node_idx,
                                          const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadWrite>& field,
-                                         array::SVector<DATA_TYPE>& send_buffer, Idx... idxs ) {
+                                         array::SVector<BUFFER_TYPE>& send_buffer, Idx... idxs ) {
         halo_packer_impl<ParallelDim, Cnt - 1, ParallelDim + 1>::apply( buf_idx, node_idx, field, send_buffer, idxs...,
                                                                         node_idx );
     }
@@ -52,55 +52,83 @@ struct halo_packer_impl<ParallelDim, Cnt, ParallelDim> {
 
 template <int ParallelDim, int CurrentDim>
 struct halo_packer_impl<ParallelDim, 0, CurrentDim> {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
+    template <typename DATA_TYPE, typename BUFFER_TYPE, int RANK, typename... Idx>
     ATLAS_HOST_DEVICE static void apply( idx_t& buf_idx, const idx_t node_idx,
                                          const array::ArrayView<DATA_TYPE, RANK, array::Intent::ReadWrite>& field,
-                                         array::SVector<DATA_TYPE>& send_buffer, Idx... idxs ) {
-        send_buffer[buf_idx++] = field( idxs... );
+                                         array::SVector<BUFFER_TYPE>& send_buffer, Idx... idxs ) {
+        send_buffer[buf_idx++] = static_cast<BUFFER_TYPE>( field( idxs... ) );
     }
 };
 
-template <int ParallelDim, int Cnt, int CurrentDim>
+/// Assign received values into the field
+struct halo_assign {
+    static constexpr bool thread_safe = true;
+    template <typename DATA_TYPE, typename BUFFER_TYPE>
+    ATLAS_HOST_DEVICE static void apply( DATA_TYPE& value, const BUFFER_TYPE& received ) {
+        value = static_cast<DATA_TYPE>( received );
+    }
+};
+
+/// Accumulate received values into the field, used by the adjoint halo exchange.
+/// A point may receive contributions from multiple tasks, so this is not thread safe.
+struct halo_add {
+    static constexpr bool thread_safe = false;
+    template <typename DATA_TYPE, typename BUFFER_TYPE>
+    ATLAS_HOST_DEVICE static void apply( DATA_TYPE& value, const BUFFER_TYPE& received ) {
+        value += static_cast<DATA_TYPE>( received );
+    }
+};
+
+/// Reset field values to zero, ignoring the buffer
+struct halo_zero {
+    static constexpr bool thread_safe = true;
+    template <typename DATA_TYPE, typename BUFFER_TYPE>
+    ATLAS_HOST_DEVICE static void apply( DATA_TYPE& value, const BUFFER_TYPE& ) {
+        value = 0;
+    }
+};
+
+template <int ParallelDim, int Cnt, int CurrentDim, typename Op = halo_assign>
 struct halo_unpacker_impl {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
+    template <typename DATA_TYPE, typename BUFFER_TYPE, int RANK, typename... Idx>
     ATLAS_HOST_DEVICE static void apply( idx_t& buf_idx, const idx_t node_idx,
-                                         array::SVector<DATA_TYPE> const& recv_buffer,
+                                         array::SVector<BUFFER_TYPE> const& recv_buffer,
                                          array::ArrayView<DATA_TYPE, RANK>& field, Idx... idxs ) {
         for ( idx_t i = 0; i < field.template shape<CurrentDim>(); ++i ) {
-            halo_unpacker_impl<ParallelDim, Cnt - 1, CurrentDim + 1>::apply( buf_idx, node_idx, recv_buffer, field,
-                                                                             idxs..., i );
+            halo_unpacker_impl<ParallelDim, Cnt - 1, CurrentDim + 1, Op>::apply( buf_idx, node_idx, recv_buffer, field,
+                                                                                 idxs..., i );
         }
     }
 };
 
-template <int ParallelDim>
-struct halo_unpacker_impl<ParallelDim, 0, ParallelDim> {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
+template <int ParallelDim, typename Op>
+struct halo_unpacker_impl<ParallelDim, 0, ParallelDim, Op> {
+    template <typename DATA_TYPE, typename BUFFER_TYPE, int RANK, typename... Idx>
     ATLAS_HOST_DEVICE static void apply( idx_t& buf_idx, const idx_t node_idx,
-                                         array::SVector<DATA_TYPE> const& recv_buffer,
+                                         array::SVector<BUFFER_TYPE> const& recv_buffer,
                                          array::ArrayView<DATA_TYPE, RANK>& field, Idx... idxs ) {
-        field( idxs... ) = recv_buffer[buf_idx++];
+        Op::apply( field( idxs... ), recv_buffer[buf_idx++] );
     }
 };
 
-template <int ParallelDim, int Cnt>
-struct halo_unpacker_impl<ParallelDim, Cnt, ParallelDim> {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
+template <int ParallelDim, int Cnt, typename Op>
+struct halo_unpacker_impl<ParallelDim, Cnt, ParallelDim, Op> {
+    template <typename DATA_TYPE, typename BUFFER_TYPE, int RANK, typename... Idx>
     ATLAS_HOST_DEVICE static void apply( idx_t& buf_idx, const idx_t node_idx,
-                                         array::SVector<DATA_TYPE> const& recv_buffer,
+                                         array::SVector<BUFFER_TYPE> const& recv_buffer,
                                          array::ArrayView<DATA_TYPE, RANK>& field, Idx... idxs ) {
-        halo_unpacker_impl<ParallelDim, Cnt - 1, ParallelDim + 1>::apply( buf_idx, node_idx, recv_buffer, field,
-                                                                          idxs..., node_idx );
+        halo_unpacker_impl<ParallelDim, Cnt - 1, ParallelDim + 1, Op>::apply( buf_idx, node_idx, recv_buffer, field,
+                                                                              idxs..., node_idx );
     }
 };
 
-template <int ParallelDim, int CurrentDim>
-struct halo_unpacker_impl<ParallelDim, 0, CurrentDim> {
-    template <typename DATA_TYPE, int RANK, typename... Idx>
+template <int ParallelDim, int CurrentDim, typename Op>
+struct halo_unpacker_impl<ParallelDim, 0, CurrentDim, Op> {
+    template <typename DATA_TYPE, typename BUFFER_TYPE, int RANK, typename... Idx>
     ATLAS_HOST_DEVICE static void apply( idx_t& buf_idx, const idx_t node_idx,
-                                         array::SVector<DATA_TYPE> const& recv_buffer,
+                                         array::SVector<BUFFER_TYPE> const& recv_buffer,
                                          array::ArrayView<DATA_TYPE, RANK>& field, Idx... idxs ) {
-        field( idxs... ) = recv_buffer[buf_idx++];
+        Op::apply( field( idxs... ), recv_buffer[buf_idx++] );
     }
 };
 
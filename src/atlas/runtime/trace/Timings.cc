@@ -11,9 +11,11 @@
 
 #include "Timings.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <limits>
+#include <mutex>
 #include <regex>
 #include <sstream>
 #include <string>
@@ -21,6 +23,8 @@
 #include "eckit/config/Configuration.h"
 #include "eckit/filesystem/PathName.h"
 
+#include "atlas/library/Library.h"
+#include "atlas/library/config.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/trace/CallStack.h"
@@ -48,6 +52,9 @@ private:
 
     std::map<std::string, std::vector<size_t>> labels_;
 
+    std::map<std::string, Timings::Communication> communication_;
+    mutable std::mutex communication_mutex_;
+
     TimingsRegistry() = default;
 
 public:
@@ -60,6 +67,13 @@ public:
 
     void update( size_t idx, double seconds );
 
+    void update( const std::string& label, const Timings::Communication& );
+
+    std::map<std::string, Timings::Communication> communication() const {
+        std::lock_guard<std::mutex> lock( communication_mutex_ );
+        return communication_;
+    }
+
     size_t size() const;
 
     void report( std::ostream& out, const eckit::Configuration& config );
@@ -108,6 +122,17 @@ void TimingsRegistry::update( size_t idx, double seconds ) {
     counts_[idx] += 1;
 }
 
+void TimingsRegistry::update( const std::string& label, const Timings::Communication& c ) {
+    std::lock_guard<std::mutex> lock( communication_mutex_ );
+    auto& acc = communication_[label];
+    acc.count += c.count;
+    acc.messages_sent += c.messages_sent;
+    acc.messages_received += c.messages_received;
+    acc.bytes_sent += c.bytes_sent;
+    acc.bytes_received += c.bytes_received;
+    acc.neighbours = std::max( acc.neighbours, c.neighbours );
+}
+
 size_t TimingsRegistry::size() const {
     return counts_.size();
 }
@@ -356,6 +381,43 @@ void TimingsRegistry::report( std::ostream& out, const eckit::Configuration& con
             << print_time( tot ) << std::endl;
     }
     out << std::left << box_horizontal( 40 ) << sepf << box_horizontal( 5 ) << sepf << box_horizontal( 12 ) << "\n";
+
+    std::lock_guard<std::mutex> lock( communication_mutex_ );
+    if ( communication_.empty() ) {
+        return;
+    }
+
+    size_t max_label_length = std::string( "Communication accumulated by label" ).size();
+    for ( const auto& entry : communication_ ) {
+        max_label_length = std::max( max_label_length, entry.first.size() );
+    }
+    const std::vector<std::string> columns{"count", "msg sent", "msg recv", "bytes sent", "bytes recv", "neighbours"};
+    const size_t w = 12;
+
+    auto print_communication_horizontal = [&]( const std::string& junction ) {
+        out << box_horizontal( max_label_length );
+        for ( size_t c = 0; c < columns.size(); ++c ) {
+            out << junction << box_horizontal( w );
+        }
+        out << "\n";
+    };
+
+    out << "\n";
+    print_communication_horizontal( sept );
+    out << std::left << std::setw( max_label_length ) << "Communication accumulated by label";
+    for ( const auto& column : columns ) {
+        out << sep << std::left << std::setw( w ) << column;
+    }
+    out << std::endl;
+    print_communication_horizontal( seph );
+    for ( const auto& entry : communication_ ) {
+        const auto& c = entry.second;
+        out << std::left << std::setw( max_label_length ) << entry.first << sep << std::left << std::setw( w )
+            << c.count << sep << std::setw( w ) << c.messages_sent << sep << std::setw( w ) << c.messages_received
+            << sep << std::setw( w ) << c.bytes_sent << sep << std::setw( w ) << c.bytes_received << sep
+            << std::setw( w ) << c.neighbours << std::endl;
+    }
+    print_communication_horizontal( sepf );
 }
 
 std::string TimingsRegistry::filter_filepath( const std::string& filepath ) const {
@@ -382,6 +444,20 @@ void Timings::update( const Identifier& id, double seconds ) {
     TimingsRegistry::instance().update( id, seconds );
 }
 
+bool Timings::communication_enabled() {
+    return ATLAS_HAVE_TRACE && ( Library::instance().trace() || Library::instance().traceReport() );
+}
+
+void Timings::update( const std::string& label, const Communication& communication ) {
+    if ( communication_enabled() ) {
+        TimingsRegistry::instance().update( label, communication );
+    }
+}
+
+std::map<std::string, Timings::Communication> Timings::communication() {
+    return TimingsRegistry::instance().communication();
+}
+
 std::string Timings::report() {
     return report( util::NoConfig() );
 }
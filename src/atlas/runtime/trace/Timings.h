@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -35,11 +36,33 @@ public:
     using Identifier    = size_t;
     using Labels        = std::vector<std::string>;
 
+    /// @brief Communication volume of parallel communication patterns (HaloExchange, GatherScatter),
+    /// as seen from this MPI task
+    struct Communication {
+        size_t count{0};              ///< Number of exchanges
+        size_t messages_sent{0};      ///< Number of messages sent
+        size_t messages_received{0};  ///< Number of messages received
+        size_t bytes_sent{0};         ///< Number of bytes sent
+        size_t bytes_received{0};     ///< Number of bytes received
+        size_t neighbours{0};         ///< Largest number of other tasks communicated with in a single exchange
+    };
+
 public:  // static methods
     static Identifier add( const CodeLocation&, const CallStack&, const std::string& title, const Labels& );
 
     static void update( const Identifier& id, double seconds );
 
+    /// @brief Whether communication volume is recorded, i.e. when tracing or the trace report is enabled.
+    /// Callers can check this before assembling a Communication.
+    static bool communication_enabled();
+
+    /// @brief Accumulate communication volume for given label, e.g. "halo-exchange:NodeColumns[halo=1]".
+    /// Does nothing unless communication_enabled(). Safe to call from multiple threads.
+    static void update( const std::string& label, const Communication& );
+
+    /// @brief Communication volume accumulated so far, by label
+    static std::map<std::string, Communication> communication();
+
     static std::string report();
 
     static std::string report( const Configuration& );
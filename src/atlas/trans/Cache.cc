@@ -9,8 +9,13 @@
  */
 
 #include "atlas/trans/Cache.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #include <cstdlib>
 
+#include "eckit/config/Resource.h"
 #include "eckit/io/DataHandle.h"
 
 #include "atlas/runtime/Exception.h"
@@ -30,6 +35,40 @@ TransCacheFileEntry::TransCacheFileEntry( const eckit::PathName& path ) : buffer
     dh->close();
 }
 
+TransCacheMappedFileEntry::TransCacheMappedFileEntry( const eckit::PathName& path ) : size_( path.size() ) {
+    ATLAS_TRACE();
+    Log::debug() << "Memory mapping cache file " << path << std::endl;
+    if ( size_ == 0 ) {
+        return;
+    }
+    int fd = ::open( path.asString().c_str(), O_RDONLY );
+    if ( fd < 0 ) {
+        throw_Exception( "Cannot open cache file " + path.asString() + " for reading", Here() );
+    }
+    void* addr = ::mmap( nullptr, size_, PROT_READ, MAP_SHARED, fd, 0 );
+    ::close( fd );
+    if ( addr == MAP_FAILED ) {
+        throw_Exception( "Cannot memory map cache file " + path.asString(), Here() );
+    }
+    data_ = addr;
+}
+
+TransCacheMappedFileEntry::~TransCacheMappedFileEntry() {
+    if ( data_ ) {
+        ::munmap( data_, size_ );
+    }
+}
+
+namespace {
+std::shared_ptr<TransCacheEntry> legendre_file_entry( const eckit::PathName& path ) {
+    static bool mmap = eckit::Resource<bool>( "$ATLAS_TRANS_CACHE_MMAP", true );
+    if ( mmap ) {
+        return std::shared_ptr<TransCacheEntry>( new TransCacheMappedFileEntry( path ) );
+    }
+    return std::shared_ptr<TransCacheEntry>( new TransCacheFileEntry( path ) );
+}
+}  // namespace
+
 TransCacheMemoryEntry::TransCacheMemoryEntry( const void* data, size_t size ) : data_( data ), size_( size ) {
     ATLAS_ASSERT( data_ );
     ATLAS_ASSERT( size_ );
@@ -41,11 +80,10 @@ LegendreFFTCache::LegendreFFTCache( const void* legendre_address, size_t legendr
            std::make_shared<TransCacheMemoryEntry>( fft_address, fft_size ) ) {}
 
 LegendreFFTCache::LegendreFFTCache( const eckit::PathName& legendre_path, const eckit::PathName& fft_path ) :
-    Cache( std::shared_ptr<TransCacheEntry>( new TransCacheFileEntry( legendre_path ) ),
+    Cache( legendre_file_entry( legendre_path ),
            std::shared_ptr<TransCacheEntry>( new TransCacheFileEntry( fft_path ) ) ) {}
 
-LegendreCache::LegendreCache( const eckit::PathName& path ) :
-    Cache( std::shared_ptr<TransCacheEntry>( new TransCacheFileEntry( path ) ) ) {}
+LegendreCache::LegendreCache( const eckit::PathName& path ) : Cache( legendre_file_entry( path ) ) {}
 
 LegendreCache::LegendreCache( size_t size ) : Cache( std::make_shared<TransCacheOwnedMemoryEntry>( size ) ) {}
 
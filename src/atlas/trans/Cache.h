@@ -68,6 +68,22 @@ public:
 
 //-----------------------------------------------------------------------------
 
+/// Read-only memory-mapped cache file. All tasks on a node mapping the same file
+/// share one copy of it in the page cache.
+class TransCacheMappedFileEntry final : public TransCacheEntry {
+private:
+    void* data_  = nullptr;
+    size_t size_ = 0;
+
+public:
+    TransCacheMappedFileEntry( const eckit::PathName& path );
+    virtual ~TransCacheMappedFileEntry() override;
+    virtual size_t size() const override { return size_; }
+    virtual const void* data() const override { return data_; }
+};
+
+//-----------------------------------------------------------------------------
+
 class TransCacheMemoryEntry final : public TransCacheEntry {
 public:
     TransCacheMemoryEntry( const void* data, size_t size );
@@ -122,6 +138,8 @@ public:
 };
 
 
+/// Cache files are memory-mapped read-only, unless ATLAS_TRANS_CACHE_MMAP=0,
+/// in which case they are read into memory owned by each task.
 class LegendreCache : public Cache {
 public:
     LegendreCache( size_t size );
@@ -53,6 +53,10 @@ std::string hash( const eckit::Configuration& config ) {
 
     // Add options and other unique keys
     h << "flt" << config.getBool( "flt", false );
+    if ( config.getBool( "single_precision", false ) ) {
+        // only added when set, to keep identifiers of existing double precision caches
+        h << "single_precision" << true;
+    }
 
     return truncate( h.digest() );
 }
@@ -141,7 +145,8 @@ Cache LegendreCacheCreatorLocal::create() const {
 }
 
 size_t LegendreCacheCreatorLocal::estimate() const {
-    return size_t( truncation_ * truncation_ * truncation_ ) / 2 * sizeof( double );
+    const size_t value_size = config_.getBool( "single_precision", false ) ? sizeof( float ) : sizeof( double );
+    return size_t( truncation_ * truncation_ * truncation_ ) / 2 * value_size;
 }
 
 
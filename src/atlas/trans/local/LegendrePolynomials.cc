@@ -14,6 +14,7 @@
 
 #include "atlas/array.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/trans/local/LegendrePolynomials.h"
 
 namespace atlas {
@@ -151,54 +152,66 @@ void compute_legendre_polynomials_lat( const int trc,     // truncation (in)
 }
 
 
-void compute_legendre_polynomials(
+namespace {
+
+template <typename T>
+void compute_legendre_polynomials_split(
     const int truncation,      // truncation (in)
     const int nlats,           // number of latitudes
     const double lats[],       // latitudes in radians (in)
-    double leg_sym[],          // values of associated Legendre functions, symmetric part
-    double leg_asym[],         // values of associated Legendre functions, asymmetric part
+    T leg_sym[],               // values of associated Legendre functions, symmetric part
+    T leg_asym[],              // values of associated Legendre functions, asymmetric part
     size_t leg_start_sym[],    // start indices for different zonal wave numbers, symmetric part
     size_t leg_start_asym[] )  // start indices for different zonal wave numbers, asymmetric part
 {
     size_t trc           = static_cast<size_t>( truncation );
     size_t legendre_size = ( trc + 2 ) * ( trc + 1 ) / 2;
-    std::vector<double> legpol( legendre_size );
     std::vector<double> zfn( ( trc + 1 ) * ( trc + 1 ) );
     auto idxmn = [&]( size_t jm, size_t jn ) { return ( 2 * trc + 3 - jm ) * jm / 2 + jn - jm; };
     compute_zfn( truncation, zfn.data() );
 
-    // Loop over latitudes:
-    for ( size_t jlat = 0; jlat < size_t( nlats ); ++jlat ) {
-        // compute legendre polynomials for current latitude:
-        compute_legendre_polynomials_lat( truncation, lats[jlat], legpol.data(), zfn.data() );
+    // Latitudes are independent: threaded over latitudes, with work arrays per thread
+    // (compute_legendre_polynomials_lat also writes to zfn)
+    atlas_omp_parallel {
+        std::vector<double> legpol( legendre_size );
+        std::vector<double> zfn_thread( zfn );
 
-        // split polynomials into symmetric and antisymmetric parts:
-        {
-            //ATLAS_TRACE( "add to global arrays" );
+        // Loop over latitudes:
+        atlas_omp_for( size_t jlat = 0; jlat < size_t( nlats ); ++jlat ) {
+            // compute legendre polynomials for current latitude:
+            compute_legendre_polynomials_lat( truncation, lats[jlat], legpol.data(), zfn_thread.data() );
 
-            for ( size_t jm = 0; jm <= trc; jm++ ) {
-                size_t is1 = 0, ia1 = 0;
-                for ( size_t jn = jm; jn <= trc; jn++ ) {
-                    ( jn - jm ) % 2 ? ia1++ : is1++;
-                }
+            // split polynomials into symmetric and antisymmetric parts:
+            {
+                //ATLAS_TRACE( "add to global arrays" );
 
-                size_t is2 = 0, ia2 = 0;
-                // the choice between the following two code lines determines whether
-                // total wavenumbers are summed in an ascending or descending order.
-                // The trans library in IFS uses descending order because it should
-                // be more accurate (higher wavenumbers have smaller contributions).
-                // This also needs to be changed when splitting the spectral data in
-                // TransLocal::invtrans_uv!
-                //for ( int jn = jm; jn <= trc; jn++ ) {
-                for ( long ljn = long( trc ), ljm = long( jm ); ljn >= ljm; ljn-- ) {
-                    size_t jn = size_t( ljn );
-                    if ( ( jn - jm ) % 2 == 0 ) {
-                        size_t is   = leg_start_sym[jm] + is1 * jlat + is2++;
-                        leg_sym[is] = legpol[idxmn( jm, jn )];
+                for ( size_t jm = 0; jm <= trc; jm++ ) {
+                    if ( leg_start_sym[jm + 1] == leg_start_sym[jm] ) {
+                        continue;  // no storage for this zonal wavenumber
+                    }
+                    size_t is1 = 0, ia1 = 0;
+                    for ( size_t jn = jm; jn <= trc; jn++ ) {
+                        ( jn - jm ) % 2 ? ia1++ : is1++;
                     }
-                    else {
-                        size_t ia    = leg_start_asym[jm] + ia1 * jlat + ia2++;
-                        leg_asym[ia] = legpol[idxmn( jm, jn )];
+
+                    size_t is2 = 0, ia2 = 0;
+                    // the choice between the following two code lines determines whether
+                    // total wavenumbers are summed in an ascending or descending order.
+                    // The trans library in IFS uses descending order because it should
+                    // be more accurate (higher wavenumbers have smaller contributions).
+                    // This also needs to be changed when splitting the spectral data in
+                    // TransLocal::invtrans_uv!
+                    //for ( int jn = jm; jn <= trc; jn++ ) {
+                    for ( long ljn = long( trc ), ljm = long( jm ); ljn >= ljm; ljn-- ) {
+                        size_t jn = size_t( ljn );
+                        if ( ( jn - jm ) % 2 == 0 ) {
+                            size_t is   = leg_start_sym[jm] + is1 * jlat + is2++;
+                            leg_sym[is] = static_cast<T>( legpol[idxmn( jm, jn )] );
+                        }
+                        else {
+                            size_t ia    = leg_start_asym[jm] + ia1 * jlat + ia2++;
+                            leg_asym[ia] = static_cast<T>( legpol[idxmn( jm, jn )] );
+                        }
                     }
                 }
             }
@@ -206,6 +219,32 @@ void compute_legendre_polynomials(
     }
 }
 
+}  // namespace
+
+void compute_legendre_polynomials(
+    const int truncation,      // truncation (in)
+    const int nlats,           // number of latitudes
+    const double lats[],       // latitudes in radians (in)
+    double leg_sym[],          // values of associated Legendre functions, symmetric part
+    double leg_asym[],         // values of associated Legendre functions, asymmetric part
+    size_t leg_start_sym[],    // start indices for different zonal wave numbers, symmetric part
+    size_t leg_start_asym[] )  // start indices for different zonal wave numbers, asymmetric part
+{
+    compute_legendre_polynomials_split( truncation, nlats, lats, leg_sym, leg_asym, leg_start_sym, leg_start_asym );
+}
+
+void compute_legendre_polynomials(
+    const int truncation,      // truncation (in)
+    const int nlats,           // number of latitudes
+    const double lats[],       // latitudes in radians (in)
+    float leg_sym[],           // values of associated Legendre functions, symmetric part
+    float leg_asym[],          // values of associated Legendre functions, asymmetric part
+    size_t leg_start_sym[],    // start indices for different zonal wave numbers, symmetric part
+    size_t leg_start_asym[] )  // start indices for different zonal wave numbers, asymmetric part
+{
+    compute_legendre_polynomials_split( truncation, nlats, lats, leg_sym, leg_asym, leg_start_sym, leg_start_asym );
+}
+
 void compute_legendre_polynomials_all( const int truncation,  // truncation (in)
                                        const int nlats,       // number of latitudes
                                        const double lats[],   // latitudes in radians (in)
@@ -214,7 +253,6 @@ void compute_legendre_polynomials_all( const int truncation,  // truncation (in)
     size_t trc           = static_cast<size_t>( truncation );
     size_t legendre_size = ( trc + 2 ) * ( trc + 1 ) / 2;
     size_t ny            = nlats;
-    std::vector<double> legpol( legendre_size );
     std::vector<double> zfn( ( trc + 1 ) * ( trc + 1 ) );
     auto idxmn  = [&]( size_t jm, size_t jn ) { return ( 2 * trc + 3 - jm ) * jm / 2 + jn - jm; };
     auto idxmnl = [&]( size_t jm, size_t jn, size_t jlat ) {
@@ -222,14 +260,20 @@ void compute_legendre_polynomials_all( const int truncation,  // truncation (in)
     };
     compute_zfn( truncation, zfn.data() );
 
-    // Loop over latitudes:
-    for ( size_t jlat = 0; jlat < ny; ++jlat ) {
-        // compute legendre polynomials for current latitude:
-        compute_legendre_polynomials_lat( truncation, lats[jlat], legpol.data(), zfn.data() );
+    // threaded over latitudes, see compute_legendre_polynomials_split
+    atlas_omp_parallel {
+        std::vector<double> legpol( legendre_size );
+        std::vector<double> zfn_thread( zfn );
+
+        // Loop over latitudes:
+        atlas_omp_for( size_t jlat = 0; jlat < ny; ++jlat ) {
+            // compute legendre polynomials for current latitude:
+            compute_legendre_polynomials_lat( truncation, lats[jlat], legpol.data(), zfn_thread.data() );
 
-        for ( size_t jm = 0; jm <= trc; ++jm ) {
-            for ( size_t jn = jm; jn <= trc; ++jn ) {
-                legendre[idxmnl( jm, jn, jlat )] = legpol[idxmn( jm, jn )];
+            for ( size_t jm = 0; jm <= trc; ++jm ) {
+                for ( size_t jn = jm; jn <= trc; ++jn ) {
+                    legendre[idxmnl( jm, jn, jlat )] = legpol[idxmn( jm, jn )];
+                }
             }
         }
     }
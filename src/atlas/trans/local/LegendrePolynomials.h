@@ -16,8 +16,8 @@ namespace atlas {
 namespace trans {
 
 //-----------------------------------------------------------------------------
-// Routine to compute the Legendre polynomials in serial according to Belousov
-// (using correction by Swarztrauber)
+// Routine to compute the Legendre polynomials according to Belousov
+// (using correction by Swarztrauber). Latitudes are computed in parallel (OpenMP)
 //
 // Reference:
 // S.L. Belousov, Tables of normalized associated Legendre Polynomials, Pergamon
@@ -39,6 +39,8 @@ void compute_legendre_polynomials_lat( const int trc,     // truncation (in)
                                        double legpol[],   // legendre polynomials
                                        double zfn[] );
 
+// Zonal wave numbers without storage (leg_start_sym[jm+1] == leg_start_sym[jm]) are skipped,
+// hence the start indices have trc+2 entries.
 void compute_legendre_polynomials(
     const int trc,              // truncation (in)
     const int nlats,            // number of latitudes
@@ -48,6 +50,16 @@ void compute_legendre_polynomials(
     size_t leg_start_sym[],     // start indices for different zonal wave numbers, symmetric part
     size_t leg_start_asym[] );  // start indices for different zonal wave numbers, asymmetric part
 
+// Same as above, with values stored in single precision (computations are done in double precision)
+void compute_legendre_polynomials(
+    const int trc,              // truncation (in)
+    const int nlats,            // number of latitudes
+    const double lats[],        // latitudes in radians (in)
+    float legendre_sym[],       // values of associated Legendre functions, symmetric part
+    float legendre_asym[],      // values of associated Legendre functions, asymmetric part
+    size_t leg_start_sym[],     // start indices for different zonal wave numbers, symmetric part
+    size_t leg_start_asym[] );  // start indices for different zonal wave numbers, asymmetric part
+
 void compute_legendre_polynomials_all( const int trc,        // truncation (in)
                                        const int nlats,      // number of latitudes
                                        const double lats[],  // latitudes in radians (in)
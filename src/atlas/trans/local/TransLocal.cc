@@ -10,12 +10,16 @@
 
 #include "atlas/trans/local/TransLocal.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <fstream>
+#include <map>
+#include <sstream>
 
 #include "eckit/config/YAMLConfiguration.h"
 #include "eckit/eckit.h"
+#include "eckit/exception/Exceptions.h"
 #include "eckit/io/DataHandle.h"
 #include "eckit/linalg/LinearAlgebra.h"
 #include "eckit/linalg/Matrix.h"
@@ -30,9 +34,13 @@
 #include "atlas/array.h"
 #include "atlas/field.h"
 #include "atlas/grid/Iterator.h"
+#include "atlas/grid/Partitioner.h"
 #include "atlas/grid/StructuredGrid.h"
+#include "atlas/grid/detail/spacing/gaussian/Latitudes.h"
 #include "atlas/option.h"
+#include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/trans/Trans.h"
@@ -40,11 +48,15 @@
 #include "atlas/trans/detail/TransFactory.h"
 #include "atlas/trans/local/LegendrePolynomials.h"
 #include "atlas/util/Constants.h"
+#include "atlas/util/Earth.h"
 
 #include "atlas/library/defines.h"
 #if ATLAS_HAVE_FFTW
 #include "fftw3.h"
 #endif
+#if ATLAS_HAVE_EIGEN
+#include <Eigen/Core>
+#endif
 
 // move latitudes at the poles to the following latitude:
 // (otherwise we would divide by zero when computing u,v from U,V)
@@ -87,6 +99,18 @@ public:
 
     bool export_legendre() const { return config_.getBool( "export_legendre", false ); }
 
+    bool single_precision() const { return config_.getBool( "single_precision", false ); }
+
+    int legendre_blocksize() const { return config_.getInt( "legendre_blocksize", 16 ); }
+
+    double legendre_tolerance() const { return config_.getDouble( "legendre_tolerance", 0. ); }
+
+    int legendre_leafsize() const { return config_.getInt( "legendre_leafsize", 32 ); }
+
+    bool distributed() const { return config_.getBool( "distributed", false ); }
+
+    std::string partitioner() const { return config_.getString( "partitioner", "equal_regions" ); }
+
     int warning() const { return config_.getInt( "warning", 1 ); }
 
     int fft() const {
@@ -180,6 +204,26 @@ size_t num_n( const int truncation, const int m, const bool symmetric ) {
     return size_t( len );
 }
 
+// Offsets of the zonal wavenumbers in spectral data of the given truncation, stored in the order of
+// zonal_wavenumbers with the field index running fastest. The last entry is the size of the spectral data.
+std::vector<idx_t> spectral_offsets( const int truncation, const int nb_fields,
+                                     const std::vector<int>& zonal_wavenumbers ) {
+    std::vector<idx_t> offsets( zonal_wavenumbers.size() + 1, 0 );
+    for ( size_t jml = 0; jml < zonal_wavenumbers.size(); jml++ ) {
+        offsets[jml + 1] = offsets[jml] + ( truncation - zonal_wavenumbers[jml] + 1 ) * 2 * nb_fields;
+    }
+    return offsets;
+}
+
+// Displacements for MPI communication with the given counts per task. The last entry is the total count.
+std::vector<int> displacements( const std::vector<int>& counts ) {
+    std::vector<int> displs( counts.size() + 1, 0 );
+    for ( size_t p = 0; p < counts.size(); p++ ) {
+        displs[p + 1] = displs[p] + counts[p];
+    }
+    return displs;
+}
+
 
 [[noreturn]] void throw_AllocationFailed( size_t bytes, const eckit::CodeLocation& loc ) {
     std::stringstream ss;
@@ -188,27 +232,31 @@ size_t num_n( const int truncation, const int m, const bool symmetric ) {
 }
 
 
-void alloc_aligned( double*& ptr, size_t n ) {
+template <typename T>
+void alloc_aligned( T*& ptr, size_t n ) {
     const size_t alignment = 64 * sizeof( double );
-    size_t bytes           = sizeof( double ) * n;
+    size_t bytes           = sizeof( T ) * n;
     int err                = posix_memalign( (void**)&ptr, alignment, bytes );
     if ( err ) {
         throw_AllocationFailed( bytes, Here() );
     }
 }
 
-void free_aligned( double*& ptr ) {
+template <typename T>
+void free_aligned( T*& ptr ) {
     free( ptr );
     ptr = nullptr;
 }
 
-void alloc_aligned( double*& ptr, size_t n, const char* msg ) {
+template <typename T>
+void alloc_aligned( T*& ptr, size_t n, const char* msg ) {
     ATLAS_ASSERT( msg );
-    Log::debug() << "TransLocal: allocating '" << msg << "': " << eckit::Bytes( sizeof( double ) * n ) << std::endl;
+    Log::debug() << "TransLocal: allocating '" << msg << "': " << eckit::Bytes( sizeof( T ) * n ) << std::endl;
     alloc_aligned( ptr, n );
 }
 
-void free_aligned( double*& ptr, const char* msg ) {
+template <typename T>
+void free_aligned( T*& ptr, const char* msg ) {
     ATLAS_ASSERT( msg );
     Log::debug() << "TransLocal: dellocating '" << msg << "'" << std::endl;
     free_aligned( ptr );
@@ -218,6 +266,510 @@ size_t add_padding( size_t n ) {
     return size_t( std::ceil( n / 8. ) ) * 8;
 }
 
+// Start indices of the Legendre polynomials of every zonal wavenumber for nlats latitudes, split into symmetric and
+// antisymmetric parts as in compute_legendre_polynomials. Only the given zonal wavenumbers get storage, or all if
+// there are none given. The last entries are the total sizes.
+void legendre_offsets( const int truncation, const size_t nlats, const std::vector<int>& zonal_wavenumbers,
+                       std::vector<size_t>& begin_sym, std::vector<size_t>& begin_asym ) {
+    std::vector<bool> keep( truncation + 1, zonal_wavenumbers.empty() );
+    for ( int jm : zonal_wavenumbers ) {
+        keep[jm] = true;
+    }
+    begin_sym.assign( truncation + 2, 0 );
+    begin_asym.assign( truncation + 2, 0 );
+    for ( int jm = 0; jm <= truncation; jm++ ) {
+        const size_t size_sym  = keep[jm] ? add_padding( num_n( truncation, jm, /*symmetric*/ true ) * nlats ) : 0;
+        const size_t size_asym = keep[jm] ? add_padding( num_n( truncation, jm, /*symmetric*/ false ) * nlats ) : 0;
+        begin_sym[jm + 1]      = begin_sym[jm] + size_sym;
+        begin_asym[jm + 1]     = begin_asym[jm] + size_asym;
+    }
+}
+
+// Per-thread work arrays for the Legendre transforms, sized for the largest zonal wavenumber (jm=0).
+// Each thread's part is padded so that threads don't share cache lines.
+template <typename T>
+struct LegendreScratch {
+    LegendreScratch( const int nb_fields, const int truncation, const int nlats ) :
+        nb_threads( atlas_omp_get_max_threads() ),
+        size_spectral( add_padding( 2 * nb_fields * num_n( truncation + 1, 0, true ) ) ),
+        size_fourier( add_padding( 2 * nb_fields * nlats ) ) {
+        alloc_aligned( data, 2 * nb_threads * ( size_spectral + size_fourier ) );
+    }
+    ~LegendreScratch() { free_aligned( data ); }
+    T* spectral_sym( int thread ) { return data + 2 * thread * ( size_spectral + size_fourier ); }
+    T* spectral_asym( int thread ) { return spectral_sym( thread ) + size_spectral; }
+    T* fourier_sym( int thread ) { return spectral_asym( thread ) + size_spectral; }
+    T* fourier_asym( int thread ) { return fourier_sym( thread ) + size_fourier; }
+
+    const int nb_threads;
+    const size_t size_spectral;
+    const size_t size_fourier;
+    T* data;
+};
+
+// C = A * B for column-major matrices A (m x k), B (k x n) and C (m x n)
+void gemm( const eckit::linalg::LinearAlgebra& linalg, const double* A, const double* B, double* C, size_t m,
+           size_t k, size_t n ) {
+    eckit::linalg::Matrix a( const_cast<double*>( A ), m, k );
+    eckit::linalg::Matrix b( const_cast<double*>( B ), k, n );
+    eckit::linalg::Matrix c( C, m, n );
+    linalg.gemm( a, b, c );
+}
+
+// Single precision variant; eckit::linalg only supports double precision
+void gemm( const eckit::linalg::LinearAlgebra&, const float* A, const float* B, float* C, size_t m, size_t k,
+           size_t n ) {
+#if ATLAS_HAVE_EIGEN
+    Eigen::Map<const Eigen::MatrixXf> a( A, m, k );
+    Eigen::Map<const Eigen::MatrixXf> b( B, k, n );
+    Eigen::Map<Eigen::MatrixXf> c( C, m, n );
+    c.noalias() = a * b;
+#else
+    for ( size_t j = 0; j < n; ++j ) {
+        float* cj = C + m * j;
+        for ( size_t i = 0; i < m; ++i ) {
+            cj[i] = 0.f;
+        }
+        for ( size_t l = 0; l < k; ++l ) {
+            const float blj = B[l + k * j];
+            const float* al = A + m * l;
+            for ( size_t i = 0; i < m; ++i ) {
+                cj[i] += al[i] * blj;
+            }
+        }
+    }
+#endif
+}
+
+// Select the Legendre polynomials of the requested precision
+template <typename T>
+const T* legendre_values( const double* values, const float* values_sp );
+
+template <>
+const double* legendre_values<double>( const double* values, const float* ) {
+    return values;
+}
+
+template <>
+const float* legendre_values<float>( const double*, const float* values_sp ) {
+    return values_sp;
+}
+
+// Legendre polynomials of blocks of Legendre latitudes [jlat_begin(), jlat_end()), split into symmetric and
+// antisymmetric parts per zonal wavenumber as in compute_legendre_polynomials.
+// Either a single block viewing precomputed polynomials, or blocks for which the polynomials are recomputed by
+// select(), so that only the polynomials of one block are held in memory.
+template <typename T>
+class LegendreBlocks {
+public:
+    // view of precomputed polynomials
+    LegendreBlocks( const int truncation, const int nlats, const T* sym, const T* asym,
+                    const std::vector<size_t>& begin_sym, const std::vector<size_t>& begin_asym ) :
+        truncation_( truncation ),
+        nlats_( nlats ),
+        blocksize_( std::max( nlats, 1 ) ),
+        sym_( sym ),
+        asym_( asym ),
+        begin_sym_( begin_sym ),
+        begin_asym_( begin_asym ) {}
+
+    // polynomials of the given zonal wavenumbers computed on the fly for blocks of blocksize latitudes
+    LegendreBlocks( const int truncation, const int nlats, const std::vector<double>& lats, const int blocksize,
+                    const std::vector<int>& zonal_wavenumbers ) :
+        truncation_( truncation ),
+        nlats_( nlats ),
+        blocksize_( std::max( std::min( blocksize, nlats ), 1 ) ),
+        lats_( lats.data() ) {
+        legendre_offsets( truncation_, blocksize_, zonal_wavenumbers, begin_sym_, begin_asym_ );
+        alloc_aligned( block_sym_, begin_sym_.back() );
+        alloc_aligned( block_asym_, begin_asym_.back() );
+        sym_  = block_sym_;
+        asym_ = block_asym_;
+    }
+
+    LegendreBlocks( const LegendreBlocks& ) = delete;
+    LegendreBlocks& operator=( const LegendreBlocks& ) = delete;
+
+    ~LegendreBlocks() {
+        if ( lats_ ) {
+            free_aligned( block_sym_ );
+            free_aligned( block_asym_ );
+        }
+    }
+
+    int size() const { return ( nlats_ + blocksize_ - 1 ) / blocksize_; }
+
+    void select( const int jblk ) {
+        jlat_begin_ = jblk * blocksize_;
+        jlat_end_   = std::min( jlat_begin_ + blocksize_, nlats_ );
+        if ( lats_ ) {
+            compute_legendre_polynomials( truncation_, jlat_end_ - jlat_begin_, lats_ + jlat_begin_, block_sym_,
+                                          block_asym_, begin_sym_.data(), begin_asym_.data() );
+        }
+    }
+
+    int jlat_begin() const { return jlat_begin_; }
+    int jlat_end() const { return jlat_end_; }
+
+    // polynomials of zonal wavenumber jm, starting at Legendre latitude jlat of the selected block
+    const T* sym( const int jm, const int jlat ) const {
+        return sym_ + begin_sym_[jm] + ( jlat - jlat_begin_ ) * num_n( truncation_, jm, true );
+    }
+    const T* asym( const int jm, const int jlat ) const {
+        return asym_ + begin_asym_[jm] + ( jlat - jlat_begin_ ) * num_n( truncation_, jm, false );
+    }
+
+private:
+    const int truncation_;
+    const int nlats_;
+    const int blocksize_;
+    const double* lats_{nullptr};
+    const T* sym_{nullptr};
+    const T* asym_{nullptr};
+    T* block_sym_{nullptr};
+    T* block_asym_{nullptr};
+    std::vector<size_t> begin_sym_;
+    std::vector<size_t> begin_asym_;
+    int jlat_begin_{0};
+    int jlat_end_{0};
+};
+
+// C = A * B^T (or C += A * B^T if accumulate) for column-major matrices A (m x k), B (n x k) and C (m x n)
+template <typename T>
+void gemm_transposed( const T* A, const T* B, T* C, size_t m, size_t k, size_t n, const bool accumulate ) {
+#if ATLAS_HAVE_EIGEN
+    using Matrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+    Eigen::Map<const Matrix> a( A, m, k );
+    Eigen::Map<const Matrix> b( B, n, k );
+    Eigen::Map<Matrix> c( C, m, n );
+    if ( accumulate ) {
+        c.noalias() += a * b.transpose();
+    }
+    else {
+        c.noalias() = a * b.transpose();
+    }
+#else
+    for ( size_t j = 0; j < n; ++j ) {
+        T* cj = C + m * j;
+        if ( not accumulate ) {
+            for ( size_t i = 0; i < m; ++i ) {
+                cj[i] = 0.;
+            }
+        }
+        for ( size_t l = 0; l < k; ++l ) {
+            const T bjl = B[j + n * l];
+            const T* al = A + m * l;
+            for ( size_t i = 0; i < m; ++i ) {
+                cj[i] += al[i] * bjl;
+            }
+        }
+    }
+#endif
+}
+
+// C = A * B as gemm, also for matrices without rows or columns (which the linear algebra backends may not accept)
+template <typename T>
+void gemm_any( const eckit::linalg::LinearAlgebra& linalg, const T* A, const T* B, T* C, size_t m, size_t k,
+               size_t n ) {
+    if ( m == 0 || n == 0 ) {
+        return;
+    }
+    if ( k == 0 ) {
+        std::fill( C, C + m * n, T( 0 ) );
+        return;
+    }
+    gemm( linalg, A, B, C, m, k, n );
+}
+
+// Interpolative decomposition M ~= M(:,skeleton) * P^T of the column-major matrix M (rows x cols), computed with a
+// column pivoted (Gram-Schmidt) QR decomposition which stops when all remaining columns have a norm below tolerance.
+// Returns the indices of the skeleton columns and P (cols x rank, column-major). M is overwritten.
+std::vector<int> interpolative_decomposition( std::vector<double>& M, const int rows, const int cols,
+                                              const double tolerance, std::vector<double>& P ) {
+    const int max_rank = std::min( rows, cols );
+    std::vector<int> perm( cols );
+    for ( int j = 0; j < cols; ++j ) {
+        perm[j] = j;
+    }
+    std::vector<double> R( size_t( max_rank ) * cols, 0. );  // R(s,j) = R[s + max_rank * j]
+    auto column = [&]( int j ) { return M.data() + size_t( rows ) * j; };
+    auto dot    = [&]( const double* a, const double* b ) {
+        double d = 0.;
+        for ( int i = 0; i < rows; ++i ) {
+            d += a[i] * b[i];
+        }
+        return d;
+    };
+    int rank = 0;
+    for ( ; rank < max_rank; ++rank ) {
+        // pivot: remaining column with the largest norm
+        int pivot    = rank;
+        double norm2 = -1.;
+        for ( int j = rank; j < cols; ++j ) {
+            const double n2 = dot( column( j ), column( j ) );
+            if ( n2 > norm2 ) {
+                norm2 = n2;
+                pivot = j;
+            }
+        }
+        if ( std::sqrt( norm2 ) <= tolerance ) {
+            break;
+        }
+        if ( pivot != rank ) {
+            std::swap_ranges( column( rank ), column( rank ) + rows, column( pivot ) );
+            std::swap_ranges( R.data() + size_t( max_rank ) * rank, R.data() + size_t( max_rank ) * ( rank + 1 ),
+                              R.data() + size_t( max_rank ) * pivot );
+            std::swap( perm[rank], perm[pivot] );
+        }
+        // orthogonalise once more against the previous columns of Q (Gram-Schmidt loses orthogonality)
+        double* q = column( rank );
+        for ( int s = 0; s < rank; ++s ) {
+            const double* qs = column( s );
+            const double c   = dot( qs, q );
+            for ( int i = 0; i < rows; ++i ) {
+                q[i] -= c * qs[i];
+            }
+            R[s + size_t( max_rank ) * rank] += c;
+        }
+        const double r = std::sqrt( dot( q, q ) );
+        if ( r <= tolerance ) {
+            break;
+        }
+        R[rank + size_t( max_rank ) * rank] = r;
+        for ( int i = 0; i < rows; ++i ) {
+            q[i] /= r;
+        }
+        for ( int j = rank + 1; j < cols; ++j ) {
+            double* mj     = column( j );
+            const double c = dot( q, mj );
+            for ( int i = 0; i < rows; ++i ) {
+                mj[i] -= c * q[i];
+            }
+            R[rank + size_t( max_rank ) * j] = c;
+        }
+    }
+
+    // P^T = [ I, R11^-1 R12 ] in pivoted order
+    P.assign( size_t( cols ) * rank, 0. );
+    std::vector<double> t( rank );
+    for ( int j = 0; j < cols; ++j ) {
+        if ( j < rank ) {
+            P[perm[j] + size_t( cols ) * j] = 1.;
+            continue;
+        }
+        for ( int s = rank - 1; s >= 0; --s ) {
+            double v = R[s + size_t( max_rank ) * j];
+            for ( int l = s + 1; l < rank; ++l ) {
+                v -= R[s + size_t( max_rank ) * l] * t[l];
+            }
+            t[s] = v / R[s + size_t( max_rank ) * s];
+        }
+        for ( int s = 0; s < rank; ++s ) {
+            P[perm[j] + size_t( cols ) * s] = t[s];
+        }
+    }
+    return std::vector<int>( perm.begin(), perm.begin() + rank );
+}
+
+// Butterfly compression of the Legendre polynomials of one zonal wavenumber and symmetry, i.e. of the matrix
+// A (rows x cols) with A(r,c) = values[c + cols * r] for Legendre latitudes r and total wavenumbers c.
+//
+// The submatrices of A of rows/2^l consecutive rows and cols*2^l/2^levels consecutive columns are numerically of
+// low rank at every level l. Starting from interpolative decompositions of the column blocks of A (level 0), the
+// row blocks are halved while the skeleton columns of neighbouring column blocks are merged and decomposed again,
+// down to 2^levels row blocks with a single column block, which are stored densely for their skeleton columns.
+// For bounded ranks, the number of operations to apply A is O((rows+cols) log(cols)) instead of O(rows*cols)
+// (M. O'Neil, F. Woolfe and V. Rokhlin, 2010; M. Tygert, Fast algorithms for spherical harmonic expansions III, 2010).
+template <typename T>
+class LegendreButterfly {
+public:
+    LegendreButterfly( const T* values, const int rows, const int cols, const double tolerance, const int leafsize );
+
+    // number of stored coefficients, i.e. the number of multiplications of apply() per vector
+    size_t size() const;
+
+    // Y = X * A^T for column-major X (nv x cols) and Y (nv x rows)
+    void apply( const eckit::linalg::LinearAlgebra&, const T* X, T* Y, const int nv ) const;
+
+    // X = Y * A for column-major Y (nv x rows) and X (nv x cols)
+    void apply_transpose( const T* Y, T* X, const int nv ) const;
+
+private:
+    int row_begin( const int level, const int i ) const { return static_cast<int>( ( long( rows_ ) * i ) >> level ); }
+    int col_begin( const int j ) const { return static_cast<int>( ( long( cols_ ) * j ) >> levels_ ); }
+
+    // offsets of the results of the nodes of a level, for nv vectors
+    std::vector<size_t> offsets( const int level, const int nv ) const;
+
+    int rows_;
+    int cols_;
+    int levels_{0};
+    // nodes (i,j) of level l: row block i < 2^l and column block j < 2^(levels-l), stored at j + 2^(levels-l) * i
+    std::vector<std::vector<int>> rank_;
+    std::vector<std::vector<std::vector<T>>> interp_;  // interpolation matrices (inputs x rank, column-major)
+    std::vector<std::vector<T>> dense_;                // row blocks of the last level: (rank x rows, column-major)
+};
+
+template <typename T>
+LegendreButterfly<T>::LegendreButterfly( const T* values, const int rows, const int cols, const double tolerance,
+                                         const int leafsize ) :
+    rows_( rows ),
+    cols_( cols ) {
+    while ( ( std::min( rows_, cols_ ) >> ( levels_ + 1 ) ) >= std::max( leafsize, 1 ) ) {
+        levels_++;
+    }
+    const int nb_nodes = 1 << levels_;
+    rank_.assign( levels_ + 1, std::vector<int>( nb_nodes, 0 ) );
+    interp_.assign( levels_ + 1, std::vector<std::vector<T>>( nb_nodes ) );
+
+    std::vector<std::vector<int>> skeleton, skeleton_prev;
+    std::vector<double> M, P;
+    for ( int level = 0; level <= levels_; ++level ) {
+        const int nb_cols = nb_nodes >> level;
+        skeleton_prev.swap( skeleton );
+        skeleton.assign( nb_nodes, std::vector<int>() );
+        for ( int i = 0; i < ( 1 << level ); ++i ) {
+            const int r0 = row_begin( level, i );
+            const int nr = row_begin( level, i + 1 ) - r0;
+            for ( int j = 0; j < nb_cols; ++j ) {
+                // columns to decompose: a column block, or the skeleton columns of the two child nodes
+                std::vector<int> columns;
+                if ( level == 0 ) {
+                    for ( int c = col_begin( j ); c < col_begin( j + 1 ); ++c ) {
+                        columns.push_back( c );
+                    }
+                }
+                else {
+                    const int child = 2 * j + 2 * nb_cols * ( i / 2 );
+                    columns         = skeleton_prev[child];
+                    columns.insert( columns.end(), skeleton_prev[child + 1].begin(), skeleton_prev[child + 1].end() );
+                }
+                const int nc = static_cast<int>( columns.size() );
+                M.resize( size_t( nr ) * nc );
+                for ( int c = 0; c < nc; ++c ) {
+                    for ( int r = 0; r < nr; ++r ) {
+                        M[r + size_t( nr ) * c] = values[columns[c] + size_t( cols_ ) * ( r0 + r )];
+                    }
+                }
+                const std::vector<int> skel = interpolative_decomposition( M, nr, nc, tolerance, P );
+
+                const int node          = j + nb_cols * i;
+                rank_[level][node]      = static_cast<int>( skel.size() );
+                interp_[level][node]    = std::vector<T>( P.begin(), P.end() );
+                for ( int s : skel ) {
+                    skeleton[node].push_back( columns[s] );
+                }
+            }
+        }
+    }
+    dense_.resize( nb_nodes );
+    for ( int i = 0; i < nb_nodes; ++i ) {
+        const int r0 = row_begin( levels_, i );
+        const int nr = row_begin( levels_, i + 1 ) - r0;
+        const int k  = rank_[levels_][i];
+        dense_[i].resize( size_t( k ) * nr );
+        for ( int r = 0; r < nr; ++r ) {
+            for ( int s = 0; s < k; ++s ) {
+                dense_[i][s + size_t( k ) * r] = values[skeleton[i][s] + size_t( cols_ ) * ( r0 + r )];
+            }
+        }
+    }
+}
+
+template <typename T>
+size_t LegendreButterfly<T>::size() const {
+    size_t size = 0;
+    for ( const auto& level : interp_ ) {
+        for ( const auto& interp : level ) {
+            size += interp.size();
+        }
+    }
+    for ( const auto& dense : dense_ ) {
+        size += dense.size();
+    }
+    return size;
+}
+
+template <typename T>
+std::vector<size_t> LegendreButterfly<T>::offsets( const int level, const int nv ) const {
+    std::vector<size_t> offset( rank_[level].size() + 1, 0 );
+    for ( size_t node = 0; node < rank_[level].size(); ++node ) {
+        offset[node + 1] = offset[node] + size_t( nv ) * rank_[level][node];
+    }
+    return offset;
+}
+
+template <typename T>
+void LegendreButterfly<T>::apply( const eckit::linalg::LinearAlgebra& linalg, const T* X, T* Y, const int nv ) const {
+    const int nb_nodes = 1 << levels_;
+    std::vector<T> z, z_prev;
+    std::vector<size_t> offset, offset_prev;
+    for ( int level = 0; level <= levels_; ++level ) {
+        const int nb_cols = nb_nodes >> level;
+        z_prev.swap( z );
+        offset_prev.swap( offset );
+        offset = offsets( level, nv );
+        z.resize( offset.back() );
+        for ( int i = 0; i < ( 1 << level ); ++i ) {
+            for ( int j = 0; j < nb_cols; ++j ) {
+                const int node = j + nb_cols * i;
+                const T* in;
+                int nb_in;
+                if ( level == 0 ) {
+                    in    = X + size_t( nv ) * col_begin( j );
+                    nb_in = col_begin( j + 1 ) - col_begin( j );
+                }
+                else {
+                    // the results of both child nodes are contiguous
+                    const int child = 2 * j + 2 * nb_cols * ( i / 2 );
+                    in              = z_prev.data() + offset_prev[child];
+                    nb_in           = rank_[level - 1][child] + rank_[level - 1][child + 1];
+                }
+                gemm_any( linalg, in, interp_[level][node].data(), z.data() + offset[node], nv, nb_in,
+                          rank_[level][node] );
+            }
+        }
+    }
+    for ( int i = 0; i < nb_nodes; ++i ) {
+        const int r0 = row_begin( levels_, i );
+        gemm_any( linalg, z.data() + offset[i], dense_[i].data(), Y + size_t( nv ) * r0, nv, rank_[levels_][i],
+                  row_begin( levels_, i + 1 ) - r0 );
+    }
+}
+
+template <typename T>
+void LegendreButterfly<T>::apply_transpose( const T* Y, T* X, const int nv ) const {
+    const int nb_nodes = 1 << levels_;
+    std::vector<size_t> offset = offsets( levels_, nv ), offset_prev;
+    std::vector<T> z( offset.back() ), z_prev;
+    for ( int i = 0; i < nb_nodes; ++i ) {
+        const int r0 = row_begin( levels_, i );
+        gemm_transposed( Y + size_t( nv ) * r0, dense_[i].data(), z.data() + offset[i], nv,
+                         row_begin( levels_, i + 1 ) - r0, rank_[levels_][i], false );
+    }
+    for ( int level = levels_; level > 0; --level ) {
+        const int nb_cols = nb_nodes >> level;
+        offset_prev       = offsets( level - 1, nv );
+        z_prev.assign( offset_prev.back(), T( 0 ) );
+        for ( int i = 0; i < ( 1 << level ); ++i ) {
+            for ( int j = 0; j < nb_cols; ++j ) {
+                const int node  = j + nb_cols * i;
+                const int child = 2 * j + 2 * nb_cols * ( i / 2 );
+                const int nb_in = rank_[level - 1][child] + rank_[level - 1][child + 1];
+                // both row blocks of a parent node contribute to its results
+                gemm_transposed( z.data() + offset[node], interp_[level][node].data(),
+                                 z_prev.data() + offset_prev[child], nv, rank_[level][node], nb_in, true );
+            }
+        }
+        z.swap( z_prev );
+        offset.swap( offset_prev );
+    }
+    for ( int j = 0; j < nb_nodes; ++j ) {
+        gemm_transposed( z.data() + offset[j], interp_[0][j].data(), X + size_t( nv ) * col_begin( j ), nv,
+                         rank_[0][j], col_begin( j + 1 ) - col_begin( j ), false );
+    }
+}
+
 }  // namespace
 
 int fourier_truncation( const int truncation,    // truncation
@@ -253,13 +805,42 @@ int fourier_truncation( const int truncation,    // truncation
 namespace detail {
 struct FFTW_Data {
 #if ATLAS_HAVE_FFTW
-    fftw_complex* in;
-    double* out;
-    std::vector<fftw_plan> plans;
+    std::vector<fftw_complex*> in;           // work array per thread
+    std::vector<double*> out;                // work array per thread
+    std::vector<fftw_plan> plans;            // regular grids: one latitude, reduced grids: one per group
+    std::vector<fftw_plan> dirplans;         // real-to-complex plans for direct transforms
+    std::vector<std::vector<idx_t>> groups;  // reduced grids: latitudes with equal number of longitudes
 #endif
 };
+
+// Butterfly compressed Legendre polynomials per zonal wavenumber (null where applying the polynomials as dense
+// matrices needs fewer operations)
+template <typename T>
+struct LegendreCompression {
+    std::vector<std::unique_ptr<LegendreButterfly<T>>> sym;
+    std::vector<std::unique_ptr<LegendreButterfly<T>>> asym;
+};
 }  // namespace detail
 
+namespace {
+// Select the compressed Legendre polynomials of the requested precision
+template <typename T>
+const detail::LegendreCompression<T>* legendre_compression( const detail::LegendreCompression<double>*,
+                                                            const detail::LegendreCompression<float>* );
+
+template <>
+const detail::LegendreCompression<double>* legendre_compression<double>(
+    const detail::LegendreCompression<double>* compression, const detail::LegendreCompression<float>* ) {
+    return compression;
+}
+
+template <>
+const detail::LegendreCompression<float>* legendre_compression<float>(
+    const detail::LegendreCompression<double>*, const detail::LegendreCompression<float>* compression_sp ) {
+    return compression_sp;
+}
+}  // namespace
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // Class TransLocal
@@ -279,6 +860,231 @@ bool TransLocal::warning( const eckit::Configuration& config ) const {
     return ( warning > 0 && grid_.size() >= warning );
 }
 
+// --------------------------------------------------------------------------------------------------------------------
+
+// Read the Legendre polynomials from the cache, or compute them (and export or write them to a cache file)
+template <typename T>
+void TransLocal::precompute_legendre( const std::vector<double>& lats, size_t size_sym, size_t size_asym,
+                                      T*& legendre_sym, T*& legendre_asym, const eckit::Configuration& config ) {
+    if ( legendre_cache_ ) {
+        // The cache only holds the polynomials, so its size tells their precision
+        const size_t nb_values = size_sym + size_asym;
+        if ( legendre_cachesize_ != sizeof( T ) * nb_values ) {
+            std::ostringstream err;
+            if ( legendre_cachesize_ == sizeof( double ) * nb_values ||
+                 legendre_cachesize_ == sizeof( float ) * nb_values ) {
+                err << "TransLocal: the precision of the Legendre cache does not match: it holds "
+                    << ( legendre_cachesize_ == sizeof( double ) * nb_values ? "double" : "single" )
+                    << " precision polynomials, but option \"single_precision\" is "
+                    << ( single_precision_ ? "true" : "false" );
+            }
+            else {
+                err << "TransLocal: the size of the Legendre cache (" << legendre_cachesize_
+                    << " bytes) does not match the " << sizeof( T ) * nb_values << " bytes expected for truncation "
+                    << truncation_ << " on this grid";
+            }
+            throw eckit::BadParameter( err.str(), Here() );
+        }
+        ReadCache legendre( legendre_cache_ );
+        legendre_sym  = legendre.read<T>( size_sym );
+        legendre_asym = legendre.read<T>( size_asym );
+        // TODO: check this is all aligned...
+    }
+    else {
+        if ( TransParameters( config ).export_legendre() ) {
+            ATLAS_ASSERT( not cache_.legendre() );
+
+            size_t bytes = sizeof( T ) * ( size_sym + size_asym );
+            Log::debug() << "TransLocal: allocating LegendreCache: " << eckit::Bytes( bytes ) << std::endl;
+            export_legendre_ = LegendreCache( bytes );
+
+            legendre_cachesize_ = export_legendre_.legendre().size();
+            legendre_cache_     = export_legendre_.legendre().data();
+            ReadCache legendre( legendre_cache_ );
+            legendre_sym  = legendre.read<T>( size_sym );
+            legendre_asym = legendre.read<T>( size_asym );
+        }
+        else {
+            alloc_aligned( legendre_sym, size_sym, "symmetric" );
+            alloc_aligned( legendre_asym, size_asym, "asymmetric" );
+        }
+
+        ATLAS_TRACE_SCOPE( "Legendre precomputations (structured)" ) {
+            compute_legendre_polynomials( truncation_ + 1, nlatsLeg_, lats.data(), legendre_sym, legendre_asym,
+                                          legendre_sym_begin_.data(), legendre_asym_begin_.data() );
+        }
+        std::string file_path = TransParameters( config ).write_legendre();
+        if ( file_path.size() ) {
+            ATLAS_TRACE( "Write LegendreCache to file" );
+            Log::debug() << "Writing Legendre cache file ..." << std::endl;
+            Log::debug() << "    path: " << file_path << std::endl;
+            WriteCache legendre( file_path );
+            legendre.write( legendre_sym, size_sym );
+            legendre.write( legendre_asym, size_asym );
+            Log::debug() << "    size: " << eckit::Bytes( legendre.pos ) << std::endl;
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+// Butterfly compression of the Legendre polynomials of the zonal wavenumbers of the Legendre transforms, for the
+// latitudes which are not truncated (nlat0_)
+template <typename T>
+void TransLocal::compress_legendre( const T* legendre_sym, const T* legendre_asym,
+                                    std::unique_ptr<detail::LegendreCompression<T>>& compression,
+                                    const eckit::Configuration& config ) const {
+    ATLAS_TRACE( "Legendre compression (butterfly)" );
+    TransParameters params( config );
+    const double tolerance = params.legendre_tolerance();
+    const int leafsize     = params.legendre_leafsize();
+    compression.reset( new detail::LegendreCompression<T> );
+    compression->sym.resize( truncation_ + 1 );
+    compression->asym.resize( truncation_ + 1 );
+    const int nb_m = static_cast<int>( zonal_wavenumbers_.size() );
+    size_t dense   = 0;
+    size_t size    = 0;
+    atlas_omp_pragma( omp parallel for schedule( dynamic, 1 ) reduction( + : dense, size ) )
+    for ( int jml = 0; jml < nb_m; jml++ ) {
+        const int jm         = zonal_wavenumbers_[jml];
+        const int jlat_begin = std::max<int>( 0, nlat0_[jm] );
+        const int nlatsm     = nlatsLegReduced_ - jlat_begin;
+
+        auto compress = [&]( const T* legendre, const size_t begin, const bool symmetric,
+                             std::unique_ptr<LegendreButterfly<T>>& butterfly ) {
+            const int nb_n = static_cast<int>( num_n( truncation_ + 1, jm, symmetric ) );
+            if ( nlatsm <= 0 || nb_n == 0 ) {
+                return;
+            }
+            const T* values = legendre + begin + size_t( jlat_begin ) * nb_n;
+            // tolerance relative to the largest norm of a polynomial over the latitudes
+            double norm = 0.;
+            for ( int jn = 0; jn < nb_n; jn++ ) {
+                double norm2 = 0.;
+                for ( int jl = 0; jl < nlatsm; jl++ ) {
+                    norm2 += double( values[jn + size_t( nb_n ) * jl] ) * values[jn + size_t( nb_n ) * jl];
+                }
+                norm = std::max( norm, std::sqrt( norm2 ) );
+            }
+            butterfly.reset( new LegendreButterfly<T>( values, nlatsm, nb_n, tolerance * norm, leafsize ) );
+            dense += size_t( nlatsm ) * nb_n;
+            if ( butterfly->size() < size_t( nlatsm ) * nb_n ) {
+                size += butterfly->size();
+            }
+            else {
+                butterfly.reset();
+                size += size_t( nlatsm ) * nb_n;
+            }
+        };
+        compress( legendre_sym, legendre_sym_begin_[jm], true, compression->sym[jm] );
+        compress( legendre_asym, legendre_asym_begin_[jm], false, compression->asym[jm] );
+    }
+    Log::debug() << "TransLocal: compressed Legendre polynomials with tolerance " << tolerance << " to " << size
+                 << " coefficients out of " << dense << std::endl;
+}
+
+namespace {
+template <typename T>
+int nb_compressed( const std::unique_ptr<detail::LegendreCompression<T>>& compression ) {
+    int nb = 0;
+    if ( compression ) {
+        for ( size_t jm = 0; jm < compression->sym.size(); ++jm ) {
+            nb += ( compression->sym[jm] || compression->asym[jm] );
+        }
+    }
+    return nb;
+}
+}  // namespace
+
+int TransLocal::nb_compressed_zonal_wavenumbers() const {
+    return nb_compressed( legendre_compression_ ) + nb_compressed( legendre_compression_sp_ );
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+// Distribution of the transforms over the MPI tasks: the Legendre transforms are distributed over the zonal
+// wavenumbers of the Spectral function space, the Fourier transforms over bands of latitudes with a similar number
+// of grid points. The grid point values are distributed with the given partitioner.
+void TransLocal::setup_distribution( const eckit::Configuration& config ) {
+    ATLAS_TRACE( "TransLocal distribution" );
+    if ( not grid_.domain().global() ) {
+        throw_NotImplemented( "TransLocal: distributed transforms are only implemented for global grids", Here() );
+    }
+    const auto& comm   = mpi::comm();
+    const int nb_parts = static_cast<int>( comm.size() );
+    const int part     = static_cast<int>( comm.rank() );
+    StructuredGrid g( grid_ );
+
+    // zonal wavenumbers (with the trans library these are distributed as in TransIFS):
+    spectral_                    = functionspace::Spectral( truncation_, util::Config( "distributed", true ) );
+    const auto zonal_wavenumbers = spectral_.zonal_wavenumbers();
+    zonal_wavenumbers_.resize( zonal_wavenumbers.size() );
+    for ( idx_t jml = 0; jml < zonal_wavenumbers.size(); jml++ ) {
+        zonal_wavenumbers_[jml] = zonal_wavenumbers( jml );
+    }
+    {
+        int nb_m = static_cast<int>( zonal_wavenumbers_.size() );
+        std::vector<int> recv_counts( nb_parts );
+        ATLAS_TRACE_MPI( ALLGATHER ) { comm.allGather( nb_m, recv_counts.begin(), recv_counts.end() ); }
+        const std::vector<int> recv_displs = displacements( recv_counts );
+        std::vector<int> recv( recv_displs[nb_parts] );
+        ATLAS_TRACE_MPI( ALLGATHER ) {
+            comm.allGatherv( zonal_wavenumbers_.begin(), zonal_wavenumbers_.end(), recv.begin(), recv_counts.data(),
+                             recv_displs.data() );
+        }
+        zonal_wavenumbers_part_.resize( nb_parts );
+        for ( int p = 0; p < nb_parts; p++ ) {
+            zonal_wavenumbers_part_[p].assign( recv.begin() + recv_displs[p], recv.begin() + recv_displs[p + 1] );
+        }
+        ATLAS_ASSERT( recv_displs[nb_parts] == truncation_ + 1 );
+    }
+
+    // bands of latitudes; band p starts at the first latitude after p/nb_parts of the grid points
+    const idx_t nlats = g.ny();
+    jlat_begin_part_.assign( nb_parts + 1, nlats );
+    jlat_begin_part_[0] = 0;
+    {
+        gidx_t npts = 0;
+        int p       = 1;
+        for ( idx_t jlat = 0; jlat < nlats; jlat++ ) {
+            while ( p < nb_parts && npts * nb_parts >= gidx_t( g.size() ) * p ) {
+                jlat_begin_part_[p++] = jlat;
+            }
+            npts += g.nx( jlat );
+        }
+    }
+    jlatFourierBegin_ = jlat_begin_part_[part];
+
+    // grid point distribution, the grid points of the band of this task in the order of the tasks owning them
+    // and the number of grid points exchanged with every task
+    distribution_     = grid::Distribution( grid_, grid::Partitioner( TransParameters( config ).partitioner() ) );
+    gidx_t jglb_begin = 0;  // global index of the first grid point of the band of this task
+    for ( idx_t jlat = 0; jlat < jlatFourierBegin_; jlat++ ) {
+        jglb_begin += g.nx( jlat );
+    }
+    idx_t nb_gp_band = 0;
+    for ( idx_t jlat = jlatFourierBegin_; jlat < jlat_begin_part_[part + 1]; jlat++ ) {
+        nb_gp_band += g.nx( jlat );
+    }
+    std::vector<int> owner( nb_gp_band );
+    gp_send_counts_.assign( nb_parts, 0 );
+    for ( idx_t jgp = 0; jgp < nb_gp_band; jgp++ ) {
+        owner[jgp] = distribution_.partition( jglb_begin + jgp );
+        gp_send_counts_[owner[jgp]]++;
+    }
+    std::vector<int> pos = displacements( gp_send_counts_ );
+    gp_band_order_.resize( nb_gp_band );
+    for ( idx_t jgp = 0; jgp < nb_gp_band; jgp++ ) {
+        gp_band_order_[pos[owner[jgp]]++] = jgp;
+    }
+    ATLAS_TRACE_MPI( ALLTOALL ) { comm.allToAll( gp_send_counts_, gp_recv_counts_ ); }
+    Log::debug() << "TransLocal: distributed over " << nb_parts << " tasks, this task transforms "
+                 << zonal_wavenumbers_.size() << " zonal wavenumbers and latitudes " << jlat_begin_part_[part]
+                 << " to " << jlat_begin_part_[part + 1] - 1 << std::endl;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
 TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& domain, const long truncation,
                         const eckit::Configuration& config ) :
     grid_( grid, domain ),
@@ -293,6 +1099,7 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
     linalg_( linear_algebra_backend() ),
     warning_( TransParameters( config ).warning() ) {
     ATLAS_TRACE( "TransLocal constructor" );
+    distributed_ = TransParameters( config ).distributed();
     double fft_threshold = 0.0;  // fraction of latitudes of the full grid down to which FFT is used.
     // This threshold needs to be adjusted depending on the dgemm and FFT performance of the machine
     // on which this code is running!
@@ -300,6 +1107,7 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
     int nlonsMax      = 0;
     int neqtr         = 0;
     useFFT_           = TransParameters( config ).fft();
+    single_precision_ = TransParameters( config ).single_precision();
     unstruct_precomp_ = ( config.has( "precompute" ) ? precompute_ : false );
     no_symmetry_      = false;
     nlatsNH_          = 0;
@@ -505,63 +1313,77 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
         }
         Log::info() << std::endl;*/
 
+        // zonal wavenumbers of the Legendre transforms and, if distributed, latitudes of the Fourier transforms:
+        if ( distributed_ ) {
+            setup_distribution( config );
+        }
+        else {
+            zonal_wavenumbers_.resize( truncation_ + 1 );
+            for ( int jm = 0; jm <= truncation_; jm++ ) {
+                zonal_wavenumbers_[jm] = jm;
+            }
+        }
+
         // precomputations for Legendre polynomials:
         {
-            const auto nlatsLeg = size_t( nlatsLeg_ );
-            size_t size_sym     = 0;
-            size_t size_asym    = 0;
-            legendre_sym_begin_.resize( truncation_ + 3 );
-            legendre_asym_begin_.resize( truncation_ + 3 );
-            legendre_sym_begin_[0]  = 0;
-            legendre_asym_begin_[0] = 0;
-            for ( idx_t jm = 0; jm <= truncation_ + 1; jm++ ) {
-                size_sym += add_padding( num_n( truncation_ + 1, jm, /*symmetric*/ true ) * nlatsLeg );
-                size_asym += add_padding( num_n( truncation_ + 1, jm, /*symmetric*/ false ) * nlatsLeg );
-                legendre_sym_begin_[jm + 1]  = size_sym;
-                legendre_asym_begin_[jm + 1] = size_asym;
-            }
-
-            if ( legendre_cache_ ) {
-                ReadCache legendre( legendre_cache_ );
-                legendre_sym_  = legendre.read<double>( size_sym );
-                legendre_asym_ = legendre.read<double>( size_asym );
-                ATLAS_ASSERT( legendre.pos == legendre_cachesize_ );
-                // TODO: check this is all aligned...
-            }
-            else {
-                if ( TransParameters( config ).export_legendre() ) {
-                    ATLAS_ASSERT( not cache_.legendre() );
-
-                    size_t bytes = sizeof( double ) * ( size_sym + size_asym );
-                    Log::debug() << "TransLocal: allocating LegendreCache: " << eckit::Bytes( bytes ) << std::endl;
-                    export_legendre_ = LegendreCache( bytes );
-
-                    legendre_cachesize_ = export_legendre_.legendre().size();
-                    legendre_cache_     = export_legendre_.legendre().data();
-                    ReadCache legendre( legendre_cache_ );
-                    legendre_sym_  = legendre.read<double>( size_sym );
-                    legendre_asym_ = legendre.read<double>( size_asym );
+            // if distributed, only the polynomials of the zonal wavenumbers of this task are kept, unless they are
+            // read from or written to a cache (which contains all zonal wavenumbers)
+            TransParameters params( config );
+            const bool all_m = not distributed_ || legendre_cache_ || params.export_legendre() ||
+                               params.write_legendre().size();
+            legendre_offsets( truncation_ + 1, size_t( nlatsLeg_ ), all_m ? std::vector<int>() : zonal_wavenumbers_,
+                              legendre_sym_begin_, legendre_asym_begin_ );
+            const size_t size_sym  = legendre_sym_begin_.back();
+            const size_t size_asym = legendre_asym_begin_.back();
+
+            legendre_on_the_fly_ = not precompute_ && not legendre_cache_;
+            if ( legendre_on_the_fly_ ) {
+                // polynomials are recomputed per block of latitudes in the Legendre transforms
+                if ( params.export_legendre() || params.write_legendre().size() ) {
+                    throw_Exception( "TransLocal: Legendre caches can not be created with precompute=false", Here() );
                 }
-                else {
-                    alloc_aligned( legendre_sym_, size_sym, "symmetric" );
-                    alloc_aligned( legendre_asym_, size_asym, "asymmetric" );
+                if ( params.legendre_tolerance() > 0. ) {
+                    throw_NotImplemented( "TransLocal: Legendre compression requires precomputed polynomials",
+                                          Here() );
                 }
+                legendre_lats_      = lats;
+                legendre_blocksize_ = params.legendre_blocksize();
+                Log::debug() << "TransLocal: computing Legendre polynomials on the fly for blocks of "
+                             << legendre_blocksize_ << " latitudes" << std::endl;
+            }
+            else if ( single_precision_ ) {
+                precompute_legendre( lats, size_sym, size_asym, legendre_sym_sp_, legendre_asym_sp_, config );
+            }
+            else {
+                precompute_legendre( lats, size_sym, size_asym, legendre_sym_, legendre_asym_, config );
+            }
+        }
 
-                ATLAS_TRACE_SCOPE( "Legendre precomputations (structured)" ) {
-                    compute_legendre_polynomials( truncation_ + 1, nlatsLeg_, lats.data(), legendre_sym_,
-                                                  legendre_asym_, legendre_sym_begin_.data(),
-                                                  legendre_asym_begin_.data() );
-                }
-                std::string file_path = TransParameters( config ).write_legendre();
-                if ( file_path.size() ) {
-                    ATLAS_TRACE( "Write LegendreCache to file" );
-                    Log::debug() << "Writing Legendre cache file ..." << std::endl;
-                    Log::debug() << "    path: " << file_path << std::endl;
-                    WriteCache legendre( file_path );
-                    legendre.write( legendre_sym_, size_sym );
-                    legendre.write( legendre_asym_, size_asym );
-                    Log::debug() << "    size: " << eckit::Bytes( legendre.pos ) << std::endl;
-                }
+        // quadrature weights for direct transforms (only possible for global Gaussian grids):
+        if ( GaussianGrid( grid_ ) && grid_.domain().global() ) {
+            ATLAS_TRACE( "Gaussian quadrature weights" );
+            const idx_t N = GaussianGrid( grid_ ).N();
+            std::vector<double> gaussian_lats( N );
+            quadrature_weights_.resize( N );
+            grid::spacing::gaussian::gaussian_quadrature_npole_equator( N, gaussian_lats.data(),
+                                                                       quadrature_weights_.data() );
+            // normalise such that the weights of both hemispheres sum up to one:
+            double sum = 0.;
+            for ( idx_t j = 0; j < N; ++j ) {
+                sum += quadrature_weights_[j];
+            }
+            for ( idx_t j = 0; j < N; ++j ) {
+                quadrature_weights_[j] *= 0.5 / sum;
+            }
+        }
+
+        // butterfly compression of the Legendre polynomials (of the zonal wavenumbers of this task):
+        if ( TransParameters( config ).legendre_tolerance() > 0. ) {
+            if ( single_precision_ ) {
+                compress_legendre( legendre_sym_sp_, legendre_asym_sp_, legendre_compression_sp_, config );
+            }
+            else {
+                compress_legendre( legendre_sym_, legendre_asym_, legendre_compression_, config );
             }
         }
 
@@ -571,8 +1393,30 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
             {
                 ATLAS_TRACE( "Fourier precomputations (FFTW)" );
                 int num_complex = ( nlonsMaxGlobal_ / 2 ) + 1;
-                fftw_->in       = fftw_alloc_complex( nlats * num_complex );
-                fftw_->out      = fftw_alloc_real( nlats * nlonsMaxGlobal_ );
+                size_t size_in  = num_complex;
+                size_t size_out = nlonsMaxGlobal_;
+                if ( not RegularGrid( gridGlobal_ ) ) {
+                    // group latitudes with equal number of longitudes (largest first), to transform them in one batch
+                    // (distributed: only the latitudes of this task, relative to jlatFourierBegin_)
+                    std::map<idx_t, std::vector<idx_t>> lats_per_nlons;
+                    const idx_t jlatFourierEnd = ( distributed_ ? jlat_begin_part_[mpi::comm().rank() + 1] : nlats );
+                    for ( idx_t jlat = jlatFourierBegin_; jlat < jlatFourierEnd; jlat++ ) {
+                        lats_per_nlons[nlonsGlobal_[jlat]].push_back( jlat - jlatFourierBegin_ );
+                    }
+                    for ( auto it = lats_per_nlons.rbegin(); it != lats_per_nlons.rend(); ++it ) {
+                        const size_t batch = it->second.size();
+                        size_in            = std::max( size_in, batch * ( it->first / 2 + 1 ) );
+                        size_out           = std::max( size_out, batch * it->first );
+                        fftw_->groups.push_back( it->second );
+                    }
+                }
+                const int nb_threads = atlas_omp_get_max_threads();
+                fftw_->in.resize( nb_threads );
+                fftw_->out.resize( nb_threads );
+                for ( int t = 0; t < nb_threads; ++t ) {
+                    fftw_->in[t]  = fftw_alloc_complex( size_in );
+                    fftw_->out[t] = fftw_alloc_real( size_out );
+                }
 
                 if ( fft_cache_ ) {
                     Log::debug() << "Import FFTW wisdom from cache" << std::endl;
@@ -593,15 +1437,32 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
                 if ( RegularGrid( gridGlobal_ ) ) {
                     fftw_->plans.resize( 1 );
                     fftw_->plans[0] =
-                        fftw_plan_many_dft_c2r( 1, &nlonsMaxGlobal_, nlats, fftw_->in, nullptr, 1, num_complex,
-                                                fftw_->out, nullptr, 1, nlonsMaxGlobal_, FFTW_ESTIMATE );
+                        fftw_plan_dft_c2r_1d( nlonsMaxGlobal_, fftw_->in[0], fftw_->out[0], FFTW_ESTIMATE );
+                    if ( not quadrature_weights_.empty() ) {
+                        fftw_->dirplans.resize( 1 );
+                        fftw_->dirplans[0] =
+                            fftw_plan_dft_r2c_1d( nlonsMaxGlobal_, fftw_->out[0], fftw_->in[0], FFTW_ESTIMATE );
+                    }
                 }
                 else {
-                    fftw_->plans.resize( nlatsLegDomain_ );
-                    for ( int j = 0; j < nlatsLegDomain_; j++ ) {
-                        int nlonsGlobalj = gs_global.nx( jlatMinLeg_ + j );
-                        //ASSERT( nlonsGlobalj > 0 && nlonsGlobalj <= nlonsMaxGlobal_ );
-                        fftw_->plans[j] = fftw_plan_dft_c2r_1d( nlonsGlobalj, fftw_->in, fftw_->out, FFTW_ESTIMATE );
+                    const idx_t nb_groups = static_cast<idx_t>( fftw_->groups.size() );
+                    fftw_->plans.resize( nb_groups );
+                    if ( not quadrature_weights_.empty() ) {
+                        fftw_->dirplans.resize( nb_groups );
+                    }
+                    for ( idx_t jgroup = 0; jgroup < nb_groups; jgroup++ ) {
+                        int nlonsGlobalj     = nlonsGlobal_[fftw_->groups[jgroup][0] + jlatFourierBegin_];
+                        int num_complexj     = ( nlonsGlobalj / 2 ) + 1;
+                        int batch            = static_cast<int>( fftw_->groups[jgroup].size() );
+                        fftw_->plans[jgroup] =
+                            fftw_plan_many_dft_c2r( 1, &nlonsGlobalj, batch, fftw_->in[0], nullptr, 1, num_complexj,
+                                                    fftw_->out[0], nullptr, 1, nlonsGlobalj, FFTW_ESTIMATE );
+                        if ( not quadrature_weights_.empty() ) {
+                            fftw_->dirplans[jgroup] =
+                                fftw_plan_many_dft_r2c( 1, &nlonsGlobalj, batch, fftw_->out[0], nullptr, 1,
+                                                        nlonsGlobalj, fftw_->in[0], nullptr, 1, num_complexj,
+                                                        FFTW_ESTIMATE );
+                        }
                     }
                 }
                 std::string file_path = TransParameters( config ).write_fft();
@@ -678,6 +1539,10 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
     }
     else {
         // unstructured grid
+        if ( distributed_ ) {
+            throw_NotImplemented( "TransLocal: distributed transforms are only implemented for structured grids",
+                                  Here() );
+        }
         if ( unstruct_precomp_ ) {
             ATLAS_TRACE( "Legendre precomputations (unstructured)" );
 
@@ -726,16 +1591,27 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const long truncat
 TransLocal::~TransLocal() {
     if ( StructuredGrid( grid_ ) && not grid_.projection() ) {
         if ( not legendre_cache_ ) {
-            free_aligned( legendre_sym_, "symmetric" );
-            free_aligned( legendre_asym_, "asymmetric" );
+            if ( single_precision_ ) {
+                free_aligned( legendre_sym_sp_, "symmetric" );
+                free_aligned( legendre_asym_sp_, "asymmetric" );
+            }
+            else {
+                free_aligned( legendre_sym_, "symmetric" );
+                free_aligned( legendre_asym_, "asymmetric" );
+            }
         }
         if ( useFFT_ ) {
 #if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
             for ( idx_t j = 0, size = static_cast<idx_t>( fftw_->plans.size() ); j < size; j++ ) {
                 fftw_destroy_plan( fftw_->plans[j] );
             }
-            fftw_free( fftw_->in );
-            fftw_free( fftw_->out );
+            for ( idx_t j = 0, size = static_cast<idx_t>( fftw_->dirplans.size() ); j < size; j++ ) {
+                fftw_destroy_plan( fftw_->dirplans[j] );
+            }
+            for ( size_t t = 0; t < fftw_->in.size(); t++ ) {
+                fftw_free( fftw_->in[t] );
+                fftw_free( fftw_->out[t] );
+            }
 #endif
         }
         else {
@@ -760,17 +1636,39 @@ const functionspace::Spectral& TransLocal::spectral() const {
 
 // --------------------------------------------------------------------------------------------------------------------
 
+size_t TransLocal::nb_spectral_coefficients() const {
+    if ( distributed_ ) {
+        return static_cast<size_t>( spectral_.nb_spectral_coefficients() );
+    }
+    return ( truncation_ + 1 ) * ( truncation_ + 2 );
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+idx_t TransLocal::nb_gridpoints() const {
+    if ( distributed_ ) {
+        idx_t nb_gp = 0;
+        for ( int count : gp_recv_counts_ ) {
+            nb_gp += count;
+        }
+        return nb_gp;
+    }
+    return grid_.size();
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
 void TransLocal::invtrans( const Field& spfield, Field& gpfield, const eckit::Configuration& config ) const {
     // VERY PRELIMINARY IMPLEMENTATION WITHOUT ANY GUARANTEES
     int nb_scalar_fields      = 1;
     const auto scalar_spectra = array::make_view<double, 1>( spfield );
     auto gp_fields            = array::make_view<double, 1>( gpfield );
 
-    if ( gp_fields.shape( 0 ) < grid().size() ) {
+    if ( gp_fields.shape( 0 ) < nb_gridpoints() ) {
         // Hopefully the halo (if present) is appended
         ATLAS_DEBUG_VAR( gp_fields.shape( 0 ) );
-        ATLAS_DEBUG_VAR( grid().size() );
-        ATLAS_ASSERT( gp_fields.shape( 0 ) < grid().size() );
+        ATLAS_DEBUG_VAR( nb_gridpoints() );
+        ATLAS_ASSERT( gp_fields.shape( 0 ) < nb_gridpoints() );
     }
 
     invtrans( nb_scalar_fields, scalar_spectra.data(), gp_fields.data(), config );
@@ -788,16 +1686,55 @@ void TransLocal::invtrans( const FieldSet& spfields, FieldSet& gpfields, const e
 
 // --------------------------------------------------------------------------------------------------------------------
 
-void TransLocal::invtrans_grad( const Field& /*spfield*/, Field& /*gradfield*/, const eckit::Configuration& ) const {
-    ATLAS_NOTIMPLEMENTED;
+void TransLocal::invtrans_grad( const Field& spfield, Field& gradfield, const eckit::Configuration& config ) const {
+    FieldSet spfields;
+    spfields.add( spfield );
+    FieldSet gradfields;
+    gradfields.add( gradfield );
+    invtrans_grad( spfields, gradfields, config );
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
-void TransLocal::invtrans_grad( const FieldSet& /*spfields*/, FieldSet& /*gradfields*/,
-                                const eckit::Configuration& ) const {
-    ATLAS_NOTIMPLEMENTED;
-}
+void TransLocal::invtrans_grad( const FieldSet& spfields, FieldSet& gradfields,
+                                const eckit::Configuration& config ) const {
+    // VERY PRELIMINARY IMPLEMENTATION WITHOUT ANY GUARANTEES
+    if ( distributed_ ) {
+        throw_NotImplemented( "TransLocal: distributed transforms are only implemented for scalar fields", Here() );
+    }
+    ATLAS_ASSERT( spfields.size() == gradfields.size() );
+    const int nb_fields = spfields.size();
+    const int nb_gp     = grid().size();
+    const int nb_spec   = 2 * legendre_size( truncation_ );
+    for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+        ATLAS_ASSERT( spfields[jfld].size() == nb_spec );
+        // gradient fields are expected with shape (nb_nodes, 2), where nodes beyond the grid size (halo) are ignored
+        ATLAS_ASSERT( gradfields[jfld].rank() == 2 && gradfields[jfld].shape( 1 ) == 2 );
+        ATLAS_ASSERT( gradfields[jfld].shape( 0 ) >= nb_gp );
+    }
+
+    // all fields are transformed together, with the field index running fastest in spectral space
+    std::vector<double> scalar_spectra( nb_fields * nb_spec );
+    for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+        const auto sp = array::make_view<double, 1>( spfields[jfld] );
+        for ( int j = 0; j < nb_spec; ++j ) {
+            scalar_spectra[jfld + nb_fields * j] = sp( j );
+        }
+    }
+
+    std::vector<double> gp_fields( 2 * nb_fields * nb_gp );
+    invtrans_grad( nb_fields, scalar_spectra.data(), gp_fields.data(), config );
+
+    for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+        auto grad           = array::make_view<double, 2>( gradfields[jfld] );
+        const double* gp_ew = gp_fields.data() + jfld * nb_gp;
+        const double* gp_ns = gp_fields.data() + ( nb_fields + jfld ) * nb_gp;
+        for ( int jgp = 0; jgp < nb_gp; ++jgp ) {
+            grad( jgp, 0 ) = gp_ew[jgp];
+            grad( jgp, 1 ) = gp_ns[jgp];
+        }
+    }
+}
 
 // --------------------------------------------------------------------------------------------------------------------
 
@@ -837,162 +1774,150 @@ void TransLocal::invtrans_vordiv2wind( const Field& spvor, const Field& spdiv, F
 
 void TransLocal::invtrans( const int nb_scalar_fields, const double scalar_spectra[], double gp_fields[],
                            const eckit::Configuration& config ) const {
-    invtrans_uv( truncation_, nb_scalar_fields, 0, scalar_spectra, gp_fields, config );
+    if ( distributed_ ) {
+        invtrans_distributed( nb_scalar_fields, scalar_spectra, gp_fields, config );
+    }
+    else {
+        invtrans_uv( truncation_, nb_scalar_fields, 0, scalar_spectra, gp_fields, config );
+    }
 }
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::invtrans_legendre( const int truncation, const int nlats, const int nb_fields,
-                                    const int /*nb_vordiv_fields*/, const double scalar_spectra[], double scl_fourier[],
-                                    const eckit::Configuration& ) const {
+                                    const int nb_vordiv_fields, const double scalar_spectra[], double scl_fourier[],
+                                    const eckit::Configuration& config ) const {
+    if ( single_precision_ ) {
+        invtrans_legendre_impl<float>( truncation, nlats, nb_fields, nb_vordiv_fields, scalar_spectra, scl_fourier,
+                                       config );
+    }
+    else {
+        invtrans_legendre_impl<double>( truncation, nlats, nb_fields, nb_vordiv_fields, scalar_spectra, scl_fourier,
+                                        config );
+    }
+}
+
+template <typename T>
+void TransLocal::invtrans_legendre_impl( const int truncation, const int nlats, const int nb_fields,
+                                         const int /*nb_vordiv_fields*/, const double scalar_spectra[],
+                                         double scl_fourier[], const eckit::Configuration& ) const {
     // Legendre transform:
     {
         Log::debug() << "Legendre dgemm: using " << nlatsLegReduced_ - nlat0_[0] << " latitudes out of "
                      << nlatsGlobal_ / 2 << std::endl;
         ATLAS_TRACE( "Inverse Legendre Transform (GEMM)" );
-        for ( int jm = 0; jm <= truncation_; jm++ ) {
-            size_t size_sym  = num_n( truncation_ + 1, jm, true );
-            size_t size_asym = num_n( truncation_ + 1, jm, false );
-            const int n_imag = ( jm ? 2 : 1 );
-            int size_fourier = nb_fields * n_imag * ( nlatsLegReduced_ - nlat0_[jm] );
-            if ( size_fourier > 0 ) {
-                auto posFourier = [&]( int jfld, int imag, int jlat, int jm, int nlatsH ) {
-                    return jfld + nb_fields * ( imag + n_imag * ( nlatsLegReduced_ - nlat0_[jm] - nlatsH + jlat ) );
-                };
-                double* scalar_sym;
-                double* scalar_asym;
-                double* scl_fourier_sym;
-                double* scl_fourier_asym;
-                alloc_aligned( scalar_sym, n_imag * nb_fields * size_sym );
-                alloc_aligned( scalar_asym, n_imag * nb_fields * size_asym );
-                alloc_aligned( scl_fourier_sym, size_fourier );
-                alloc_aligned( scl_fourier_asym, size_fourier );
-                {
-                    //ATLAS_TRACE( "Legendre split" );
-                    idx_t idx = 0, is = 0, ia = 0, ioff = ( 2 * truncation + 3 - jm ) * jm / 2 * nb_fields * 2;
-                    // the choice between the following two code lines determines whether
-                    // total wavenumbers are summed in an ascending or descending order.
-                    // The trans library in IFS uses descending order because it should
-                    // be more accurate (higher wavenumbers have smaller contributions).
-                    // This also needs to be changed when splitting the spectral data in
-                    // compute_legendre_polynomials!
-                    //for ( int jn = jm; jn <= truncation_ + 1; jn++ ) {
-                    for ( int jn = truncation_ + 1; jn >= jm; jn-- ) {
-                        for ( int imag = 0; imag < n_imag; imag++ ) {
-                            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                                idx = jfld + nb_fields * ( imag + 2 * ( jn - jm ) );
-                                if ( jn <= truncation && jm < truncation ) {
-                                    if ( ( jn - jm ) % 2 == 0 ) {
-                                        scalar_sym[is++] = scalar_spectra[idx + ioff];
-                                    }
-                                    else {
-                                        scalar_asym[ia++] = scalar_spectra[idx + ioff];
-                                    }
-                                }
-                                else {
-                                    if ( ( jn - jm ) % 2 == 0 ) {
-                                        scalar_sym[is++] = 0.;
+        std::unique_ptr<LegendreBlocks<T>> legendre(
+            legendre_on_the_fly_
+                ? new LegendreBlocks<T>( truncation_ + 1, nlatsLegReduced_, legendre_lats_, legendre_blocksize_,
+                                         zonal_wavenumbers_ )
+                : new LegendreBlocks<T>( truncation_ + 1, nlatsLegReduced_,
+                                         legendre_values<T>( legendre_sym_, legendre_sym_sp_ ),
+                                         legendre_values<T>( legendre_asym_, legendre_asym_sp_ ), legendre_sym_begin_,
+                                         legendre_asym_begin_ ) );
+        const detail::LegendreCompression<T>* compression =
+            legendre_compression<T>( legendre_compression_.get(), legendre_compression_sp_.get() );
+        LegendreScratch<T> scratch( nb_fields, truncation_, nlatsLegReduced_ );
+        const int nb_m                 = static_cast<int>( zonal_wavenumbers_.size() );
+        const std::vector<idx_t> ioffs = spectral_offsets( truncation, nb_fields, zonal_wavenumbers_ );
+        for ( int jblk = 0; jblk < legendre->size(); jblk++ ) {
+            legendre->select( jblk );
+            // threaded over zonal wavenumbers; the work per wavenumber decreases with jm
+            atlas_omp_pragma( omp parallel for schedule( dynamic, 1 ) num_threads( scratch.nb_threads ) )
+            for ( int jml = 0; jml < nb_m; jml++ ) {
+                const int jm     = zonal_wavenumbers_[jml];
+                size_t size_sym  = num_n( truncation_ + 1, jm, true );
+                size_t size_asym = num_n( truncation_ + 1, jm, false );
+                const int n_imag = ( jm ? 2 : 1 );
+                // Legendre latitudes of this block that are not truncated for jm (the others remain zero)
+                const int jlat_begin = std::max<int>( legendre->jlat_begin(), nlat0_[jm] );
+                const int nlatsm     = legendre->jlat_end() - jlat_begin;
+                if ( nlatsm > 0 ) {
+                    auto posFourier = [&]( int jfld, int imag, int jl ) {
+                        return jfld + nb_fields * ( imag + n_imag * jl );
+                    };
+                    const int thread    = atlas_omp_get_thread_num();
+                    T* scalar_sym       = scratch.spectral_sym( thread );
+                    T* scalar_asym      = scratch.spectral_asym( thread );
+                    T* scl_fourier_sym  = scratch.fourier_sym( thread );
+                    T* scl_fourier_asym = scratch.fourier_asym( thread );
+                    {
+                        //ATLAS_TRACE( "Legendre split" );
+                        idx_t idx = 0, is = 0, ia = 0, ioff = ioffs[jml];
+                        // the choice between the following two code lines determines whether
+                        // total wavenumbers are summed in an ascending or descending order.
+                        // The trans library in IFS uses descending order because it should
+                        // be more accurate (higher wavenumbers have smaller contributions).
+                        // This also needs to be changed when splitting the spectral data in
+                        // compute_legendre_polynomials!
+                        //for ( int jn = jm; jn <= truncation_ + 1; jn++ ) {
+                        for ( int jn = truncation_ + 1; jn >= jm; jn-- ) {
+                            for ( int imag = 0; imag < n_imag; imag++ ) {
+                                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                                    idx = jfld + nb_fields * ( imag + 2 * ( jn - jm ) );
+                                    if ( jn <= truncation && jm < truncation ) {
+                                        if ( ( jn - jm ) % 2 == 0 ) {
+                                            scalar_sym[is++] = static_cast<T>( scalar_spectra[idx + ioff] );
+                                        }
+                                        else {
+                                            scalar_asym[ia++] = static_cast<T>( scalar_spectra[idx + ioff] );
+                                        }
                                     }
                                     else {
-                                        scalar_asym[ia++] = 0.;
+                                        if ( ( jn - jm ) % 2 == 0 ) {
+                                            scalar_sym[is++] = 0.;
+                                        }
+                                        else {
+                                            scalar_asym[ia++] = 0.;
+                                        }
                                     }
                                 }
                             }
                         }
+                        ATLAS_ASSERT( size_t( ia ) == n_imag * nb_fields * size_asym &&
+                                      size_t( is ) == n_imag * nb_fields * size_sym );
                     }
-                    ATLAS_ASSERT( size_t( ia ) == n_imag * nb_fields * size_asym &&
-                                  size_t( is ) == n_imag * nb_fields * size_sym );
-                }
-                if ( nlatsLegReduced_ - nlat0_[jm] > 0 ) {
-                    {
-                        eckit::linalg::Matrix A( scalar_sym, nb_fields * n_imag, size_sym );
-                        eckit::linalg::Matrix B( legendre_sym_ + legendre_sym_begin_[jm] + nlat0_[jm] * size_sym,
-                                                 size_sym, nlatsLegReduced_ - nlat0_[jm] );
-                        eckit::linalg::Matrix C( scl_fourier_sym, nb_fields * n_imag, nlatsLegReduced_ - nlat0_[jm] );
-                        linalg_.gemm( A, B, C );
-                        /*Log::info() << "sym: ";
-                        for ( int j = 0; j < size_sym * ( nlatsLegReduced_ - nlat0_[jm] ); j++ ) {
-                            Log::info() << legendre_sym_[j + legendre_sym_begin_[jm] + nlat0_[jm] * size_sym] << " ";
-                        }
-                        Log::info() << std::endl;*/
+                    // butterfly compressed polynomials cover all latitudes (they are only used if precomputed)
+                    const LegendreButterfly<T>* butterfly_sym  = compression ? compression->sym[jm].get() : nullptr;
+                    const LegendreButterfly<T>* butterfly_asym = compression ? compression->asym[jm].get() : nullptr;
+                    if ( butterfly_sym ) {
+                        butterfly_sym->apply( linalg_, scalar_sym, scl_fourier_sym, nb_fields * n_imag );
                     }
-                    if ( size_asym > 0 ) {
-                        eckit::linalg::Matrix A( scalar_asym, nb_fields * n_imag, size_asym );
-                        eckit::linalg::Matrix B( legendre_asym_ + legendre_asym_begin_[jm] + nlat0_[jm] * size_asym,
-                                                 size_asym, nlatsLegReduced_ - nlat0_[jm] );
-                        eckit::linalg::Matrix C( scl_fourier_asym, nb_fields * n_imag, nlatsLegReduced_ - nlat0_[jm] );
-                        linalg_.gemm( A, B, C );
-                        /*Log::info() << "asym: ";
-                        for ( int j = 0; j < size_asym * ( nlatsLegReduced_ - nlat0_[jm] ); j++ ) {
-                            Log::info() << legendre_asym_[j + legendre_asym_begin_[jm] + nlat0_[jm] * size_asym] << " ";
-                        }
-                        Log::info() << std::endl;*/
+                    else {
+                        gemm( linalg_, scalar_sym, legendre->sym( jm, jlat_begin ), scl_fourier_sym,
+                              nb_fields * n_imag, size_sym, nlatsm );
                     }
-                }
-                {
-                    //ATLAS_TRACE( "merge spheres" );
-                    // northern hemisphere:
-                    for ( int jlat = 0; jlat < nlatsNH_; jlat++ ) {
-                        if ( nlatsLegReduced_ - nlat0_[jm] - nlatsNH_ + jlat >= 0 ) {
-                            for ( int imag = 0; imag < n_imag; imag++ ) {
-                                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                                    int idx = posFourier( jfld, imag, jlat, jm, nlatsNH_ );
-                                    scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] =
-                                        scl_fourier_sym[idx] + scl_fourier_asym[idx];
-                                }
-                            }
-                        }
-                        else {
-                            for ( int imag = 0; imag < n_imag; imag++ ) {
-                                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                                    scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] = 0.;
-                                }
-                            }
-                        }
-                        /*for ( int imag = 0; imag < n_imag; imag++ ) {
-                        for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                            if ( scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] > 0. ) {
-                                Log::info() << "jm=" << jm << " jlat=" << jlat << " nlatsLeg_=" << nlatsLeg_
-                                            << " nlat0=" << nlat0_[jm] << " nlatsNH=" << nlatsNH_ << std::endl;
-                            }
-                        }
-                    }*/
+                    if ( butterfly_asym ) {
+                        butterfly_asym->apply( linalg_, scalar_asym, scl_fourier_asym, nb_fields * n_imag );
                     }
-                    // southern hemisphere:
-                    for ( int jlat = 0; jlat < nlatsSH_; jlat++ ) {
-                        int jslat = nlats - jlat - 1;
-                        if ( nlatsLegReduced_ - nlat0_[jm] - nlatsSH_ + jlat >= 0 ) {
-                            for ( int imag = 0; imag < n_imag; imag++ ) {
-                                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                                    int idx = posFourier( jfld, imag, jlat, jm, nlatsSH_ );
-                                    scl_fourier[posMethod( jfld, imag, jslat, jm, nb_fields, nlats )] =
-                                        scl_fourier_sym[idx] - scl_fourier_asym[idx];
-                                }
-                            }
-                        }
-                        else {
+                    else if ( size_asym > 0 ) {
+                        gemm( linalg_, scalar_asym, legendre->asym( jm, jlat_begin ), scl_fourier_asym,
+                              nb_fields * n_imag, size_asym, nlatsm );
+                    }
+                    {
+                        //ATLAS_TRACE( "merge spheres" );
+                        // Legendre latitude jlat_begin+jl is latitude jlatN of the northern hemisphere and
+                        // latitude nlats-jlatS-1 of the southern hemisphere (if within the grid)
+                        for ( int jl = 0; jl < nlatsm; jl++ ) {
+                            const int jlatN = jlat_begin + jl - ( nlatsLegReduced_ - nlatsNH_ );
+                            const int jlatS = jlat_begin + jl - ( nlatsLegReduced_ - nlatsSH_ );
                             for ( int imag = 0; imag < n_imag; imag++ ) {
                                 for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                                    scl_fourier[posMethod( jfld, imag, jslat, jm, nb_fields, nlats )] = 0.;
+                                    int idx = posFourier( jfld, imag, jl );
+                                    if ( jlatN >= 0 ) {
+                                        scl_fourier[posMethod( jfld, imag, jlatN, jml, nb_fields, nlats, nb_m )] =
+                                            scl_fourier_sym[idx] + scl_fourier_asym[idx];
+                                    }
+                                    if ( jlatS >= 0 ) {
+                                        const int jlat = nlats - jlatS - 1;
+                                        scl_fourier[posMethod( jfld, imag, jlat, jml, nb_fields, nlats, nb_m )] =
+                                            scl_fourier_sym[idx] - scl_fourier_asym[idx];
+                                    }
                                 }
                             }
                         }
                     }
                 }
-                free_aligned( scalar_sym );
-                free_aligned( scalar_asym );
-                free_aligned( scl_fourier_sym );
-                free_aligned( scl_fourier_asym );
-            }
-            else {
-                for ( int jlat = 0; jlat < nlats; jlat++ ) {
-                    for ( int imag = 0; imag < n_imag; imag++ ) {
-                        for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                            scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] = 0.;
-                        }
-                    }
-                }
             }
         }
     }
@@ -1006,34 +1931,36 @@ void TransLocal::invtrans_fourier_regular( const int nlats, const int nlons, con
     if ( useFFT_ ) {
 #if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
         {
-            int num_complex = ( nlonsMaxGlobal_ / 2 ) + 1;
+            int num_complex      = ( nlonsMaxGlobal_ / 2 ) + 1;
+            const int nb_threads = static_cast<int>( fftw_->in.size() );
             {
                 ATLAS_TRACE( "Inverse Fourier Transform (FFTW, RegularGrid)" );
-                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                    int idx = 0;
-                    for ( int jlat = 0; jlat < nlats; jlat++ ) {
-                        fftw_->in[idx++][0] = scl_fourier[posMethod( jfld, 0, jlat, 0, nb_fields, nlats )];
-                        for ( int jm = 1; jm < num_complex; jm++, idx++ ) {
-                            for ( int imag = 0; imag < 2; imag++ ) {
-                                if ( jm <= truncation_ ) {
-                                    fftw_->in[idx][imag] =
-                                        scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )];
-                                }
-                                else {
-                                    fftw_->in[idx][imag] = 0.;
-                                }
+                // threaded over latitudes (and fields), each thread transforms into its own work arrays
+                atlas_omp_pragma( omp parallel for schedule( static ) num_threads( nb_threads ) )
+                for ( int jfldlat = 0; jfldlat < nb_fields * nlats; jfldlat++ ) {
+                    const int jfld   = jfldlat / nlats;
+                    const int jlat   = jfldlat % nlats;
+                    fftw_complex* in = fftw_->in[atlas_omp_get_thread_num()];
+                    double* out      = fftw_->out[atlas_omp_get_thread_num()];
+                    in[0][0]         = scl_fourier[posMethod( jfld, 0, jlat, 0, nb_fields, nlats )];
+                    in[0][1]         = 0.;
+                    for ( int jm = 1; jm < num_complex; jm++ ) {
+                        for ( int imag = 0; imag < 2; imag++ ) {
+                            if ( jm <= truncation_ ) {
+                                in[jm][imag] = scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )];
+                            }
+                            else {
+                                in[jm][imag] = 0.;
                             }
                         }
                     }
-                    fftw_execute_dft_c2r( fftw_->plans[0], fftw_->in, fftw_->out );
-                    for ( int jlat = 0; jlat < nlats; jlat++ ) {
-                        for ( int jlon = 0; jlon < nlons; jlon++ ) {
-                            int j = jlon + jlonMin_[0];
-                            if ( j >= nlonsMaxGlobal_ ) {
-                                j -= nlonsMaxGlobal_;
-                            }
-                            gp_fields[jlon + nlons * ( jlat + nlats * jfld )] = fftw_->out[j + nlonsMaxGlobal_ * jlat];
+                    fftw_execute_dft_c2r( fftw_->plans[0], in, out );
+                    for ( int jlon = 0; jlon < nlons; jlon++ ) {
+                        int j = jlon + jlonMin_[0];
+                        if ( j >= nlonsMaxGlobal_ ) {
+                            j -= nlonsMaxGlobal_;
                         }
+                        gp_fields[jlon + nlons * ( jlat + nlats * jfld )] = out[j];
                     }
                 }
             }
@@ -1095,44 +2022,52 @@ void TransLocal::invtrans_fourier_reduced( const int nlats, const StructuredGrid
         {
             {
                 ATLAS_TRACE( "Inverse Fourier Transform (FFTW, ReducedGrid)" );
-                int jgp = 0;
-                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                    for ( int jlat = 0; jlat < nlats; jlat++ ) {
-                        int idx = 0;
-                        //Log::info() << jlat << "in:" << std::endl;
-                        int num_complex     = ( nlonsGlobal_[jlat] / 2 ) + 1;
-                        fftw_->in[idx++][0] = scl_fourier[posMethod( jfld, 0, jlat, 0, nb_fields, nlats )];
-                        //Log::info() << fftw_->in[0][0] << " ";
-                        for ( int jm = 1; jm < num_complex; jm++, idx++ ) {
+                const int nb_threads = static_cast<int>( fftw_->in.size() );
+                // latitudes jlat are counted from jlatFourierBegin_ (non-zero for distributed transforms)
+                std::vector<idx_t> jgp_begin( nlats + 1, 0 );
+                for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                    jgp_begin[jlat + 1] = jgp_begin[jlat] + g.nx( jlat + jlatFourierBegin_ );
+                }
+                // threaded over groups of latitudes with equal number of longitudes (and fields);
+                // each group is transformed in one batch in the work arrays of the thread
+                const int nb_groups = static_cast<int>( fftw_->groups.size() );
+                atlas_omp_pragma( omp parallel for schedule( dynamic, 1 ) num_threads( nb_threads ) )
+                for ( int jgrpfld = 0; jgrpfld < nb_groups * nb_fields; jgrpfld++ ) {
+                    const int jgroup               = jgrpfld / nb_fields;
+                    const int jfld                 = jgrpfld % nb_fields;
+                    const std::vector<idx_t>& lats = fftw_->groups[jgroup];
+                    const int nlons                = nlonsGlobal_[lats[0] + jlatFourierBegin_];
+                    const int num_complex          = ( nlons / 2 ) + 1;
+                    fftw_complex* in               = fftw_->in[atlas_omp_get_thread_num()];
+                    double* out                    = fftw_->out[atlas_omp_get_thread_num()];
+                    for ( size_t jbatch = 0; jbatch < lats.size(); jbatch++ ) {
+                        const int jlat    = lats[jbatch];
+                        fftw_complex* inj = in + jbatch * num_complex;
+                        inj[0][0]         = scl_fourier[posMethod( jfld, 0, jlat, 0, nb_fields, nlats )];
+                        inj[0][1]         = 0.;
+                        for ( int jm = 1; jm < num_complex; jm++ ) {
                             for ( int imag = 0; imag < 2; imag++ ) {
                                 if ( jm <= truncation_ ) {
-                                    fftw_->in[idx][imag] =
-                                        scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )];
+                                    inj[jm][imag] = scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )];
                                 }
                                 else {
-                                    fftw_->in[idx][imag] = 0.;
+                                    inj[jm][imag] = 0.;
                                 }
-                                //Log::info() << fftw_->in[idx][imag] << " ";
                             }
                         }
-                        //Log::info() << std::endl;
-                        //Log::info() << jlat << "out:" << std::endl;
-                        int jplan = nlatsLegDomain_ - nlatsNH_ + jlat;
-                        if ( jplan >= nlatsLegDomain_ ) {
-                            jplan = nlats - 1 + nlatsLegDomain_ - nlatsSH_ - jlat;
-                        };
-                        //ASSERT( jplan < nlatsLeg_ && jplan >= 0 );
-                        fftw_execute_dft_c2r( fftw_->plans[jplan], fftw_->in, fftw_->out );
-                        for ( int jlon = 0; jlon < g.nx( jlat ); jlon++ ) {
-                            int j = jlon + jlonMin_[jlat];
-                            if ( j >= nlonsGlobal_[jlat] ) {
-                                j -= nlonsGlobal_[jlat];
+                    }
+                    fftw_execute_dft_c2r( fftw_->plans[jgroup], in, out );
+                    for ( size_t jbatch = 0; jbatch < lats.size(); jbatch++ ) {
+                        const int jlat     = lats[jbatch];
+                        const double* outj = out + jbatch * nlons;
+                        idx_t jgp          = jfld * jgp_begin[nlats] + jgp_begin[jlat];
+                        for ( int jlon = 0; jlon < g.nx( jlat + jlatFourierBegin_ ); jlon++ ) {
+                            int j = jlon + jlonMin_[jlat + jlatFourierBegin_];
+                            if ( j >= nlons ) {
+                                j -= nlons;
                             }
-                            //Log::info() << fftw_->out[j] << " ";
-                            ATLAS_ASSERT( j < nlonsMaxGlobal_ );
-                            gp_fields[jgp++] = fftw_->out[j];
+                            gp_fields[jgp++] = outj[j];
                         }
-                        //Log::info() << std::endl;
                     }
                 }
             }
@@ -1461,6 +2396,14 @@ void extend_truncation( const int old_truncation, const int nb_fields, const dou
 void TransLocal::invtrans( const int nb_scalar_fields, const double scalar_spectra[], const int nb_vordiv_fields,
                            const double vorticity_spectra[], const double divergence_spectra[], double gp_fields[],
                            const eckit::Configuration& config ) const {
+    if ( distributed_ ) {
+        if ( nb_vordiv_fields > 0 ) {
+            throw_NotImplemented( "TransLocal: distributed transforms are only implemented for scalar fields",
+                                  Here() );
+        }
+        invtrans_distributed( nb_scalar_fields, scalar_spectra, gp_fields, config );
+        return;
+    }
     int nb_gp = grid_.size();
     if ( nb_vordiv_fields > 0 ) {
         // collect all spectral data into one array "all_spectra":
@@ -1535,47 +2478,719 @@ void TransLocal::invtrans( const int nb_scalar_fields, const double scalar_spect
     }
 }
 
+// --------------------------------------------------------------------------------------------------------------------
+// Routine to compute the spectral coefficients of cos(latitude) times the gradient of scalar fields, with the
+// truncation increased by one. For every coefficient the east-west components of all fields are followed by the
+// north-south components (the data layout used for U and V in invtrans).
+// d/dlambda is a multiplication with i*m, cos(phi)*d/dphi = (1-mu^2)*d/dmu follows from the recurrence relation of
+// the Legendre polynomials, see eq.(2.13) in [Temperton 1991].
+void scalar_to_grad( const int truncation, const int nb_fields, const double scalar_spectra[],
+                     double grad_spectra[] ) {
+    const double ra_inv = 1. / util::Earth::radius();
+    auto epsilon        = []( const int n, const int m ) {
+        return ( n > m ) ? std::sqrt( ( n * n - m * m ) / ( 4. * n * n - 1. ) ) : 0.;
+    };
+    int k = 0;
+    for ( int m = 0; m <= truncation + 1; m++ ) {  // zonal wavenumber
+        const int ioff = ( 2 * truncation + 3 - m ) * m / 2 * nb_fields * 2;
+        // spectral coefficient in the original truncation (zero outside)
+        auto spec = [&]( const int n, const int imag, const int jfld ) {
+            return ( m <= truncation && n >= m && n <= truncation )
+                       ? scalar_spectra[ioff + jfld + nb_fields * ( imag + 2 * ( n - m ) )]
+                       : 0.;
+        };
+        for ( int n = m; n <= truncation + 1; n++ ) {  // total wavenumber
+            const double cm1 = -( n - 1 ) * epsilon( n, m ) * ra_inv;
+            const double cp1 = ( n + 2 ) * epsilon( n + 1, m ) * ra_inv;
+            for ( int imag = 0; imag < 2; imag++ ) {              // real/imaginary part
+                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {  // east-west derivatives
+                    grad_spectra[k++] = ( imag == 0 ? -m * spec( n, 1, jfld ) : m * spec( n, 0, jfld ) ) * ra_inv;
+                }
+                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {  // north-south derivatives
+                    grad_spectra[k++] = cm1 * spec( n - 1, imag, jfld ) + cp1 * spec( n + 1, imag, jfld );
+                }
+            }
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Inverse transform of the gradients of scalar fields. The east-west and north-south derivatives of all fields are
+// computed in one Legendre and Fourier pass; the division by cos(latitude) is the one used for the wind components.
+// gp_fields contains the east-west derivatives of all fields followed by the north-south derivatives.
+void TransLocal::invtrans_grad( const int nb_fields, const double scalar_spectra[], double gp_fields[],
+                                const eckit::Configuration& config ) const {
+    ATLAS_TRACE( "TransLocal::invtrans_grad" );
+    std::vector<double> grad_spectra( 2 * 2 * legendre_size( truncation_ + 1 ) * nb_fields );
+    {
+        ATLAS_TRACE( "scalar to gradient" );
+        scalar_to_grad( truncation_, nb_fields, scalar_spectra, grad_spectra.data() );
+    }
+    invtrans_uv( truncation_ + 1, 2 * nb_fields, nb_fields, grad_spectra.data(), gp_fields, config );
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::dirtrans( const Field& gpfield, Field& spfield, const eckit::Configuration& config ) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+    int nb_scalar_fields = 1;
+    const auto gp_fields = array::make_view<double, 1>( gpfield );
+    auto scalar_spectra  = array::make_view<double, 1>( spfield );
+
+    // Halo points (if present) are expected to be appended and are ignored
+    ATLAS_ASSERT( gp_fields.shape( 0 ) >= nb_gridpoints() );
+    ATLAS_ASSERT( scalar_spectra.shape( 0 ) >= static_cast<idx_t>( nb_spectral_coefficients() ) );
+
+    dirtrans( nb_scalar_fields, gp_fields.data(), scalar_spectra.data(), config );
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::dirtrans( const FieldSet& gpfields, FieldSet& spfields, const eckit::Configuration& config ) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+    ATLAS_ASSERT( gpfields.size() == spfields.size() );
+    for ( idx_t f = 0; f < gpfields.size(); ++f ) {
+        dirtrans( gpfields[f], spfields[f], config );
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::dirtrans_fourier_regular( const int nlats, const int nlons, const int nb_fields,
+                                           const double gp_fields[], double scl_fourier[],
+                                           const eckit::Configuration& ) const {
+    // Fourier transformation:
+    if ( useFFT_ ) {
+#if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
+        {
+            int num_complex      = ( nlonsMaxGlobal_ / 2 ) + 1;
+            const double scale   = 1. / nlonsMaxGlobal_;
+            const int nb_threads = static_cast<int>( fftw_->in.size() );
+            {
+                ATLAS_TRACE( "Direct Fourier Transform (FFTW, RegularGrid)" );
+                atlas_omp_pragma( omp parallel for schedule( static ) num_threads( nb_threads ) )
+                for ( int jfldlat = 0; jfldlat < nb_fields * nlats; jfldlat++ ) {
+                    const int jfld   = jfldlat / nlats;
+                    const int jlat   = jfldlat % nlats;
+                    fftw_complex* in = fftw_->in[atlas_omp_get_thread_num()];
+                    double* out      = fftw_->out[atlas_omp_get_thread_num()];
+                    for ( int jlon = 0; jlon < nlons; jlon++ ) {
+                        out[jlon] = gp_fields[jlon + nlons * ( jlat + nlats * jfld )];
+                    }
+                    fftw_execute_dft_r2c( fftw_->dirplans[0], out, in );
+                    for ( int jm = 0; jm <= truncation_; jm++ ) {
+                        for ( int imag = 0; imag < 2; imag++ ) {
+                            scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] =
+                                ( jm < num_complex ? in[jm][imag] * scale : 0. );
+                        }
+                    }
+                }
+            }
+        }
+#endif
+    }
+    else {
+#if !TRANSLOCAL_DGEMM2
+        {
+            ATLAS_TRACE( "Direct Fourier Transform (NoFFT)" );
+            StructuredGrid g( grid_ );
+            const int nb_fourier = ( truncation_ + 1 ) * 2;
+            double* fourier_dir;
+            alloc_aligned( fourier_dir, nb_fourier * nlons );
+            for ( int jlon = 0; jlon < nlons; jlon++ ) {
+                double lon = g.x( jlon, 0 ) * util::Constants::degreesToRadians();
+                for ( int jm = 0; jm <= truncation_; jm++ ) {
+                    fourier_dir[2 * jm + nb_fourier * jlon]     = +std::cos( jm * lon ) / nlons;  // real part
+                    fourier_dir[2 * jm + 1 + nb_fourier * jlon] = -std::sin( jm * lon ) / nlons;  // imaginary part
+                }
+            }
+            eckit::linalg::Matrix A( fourier_dir, nb_fourier, nlons );
+            eckit::linalg::Matrix B( const_cast<double*>( gp_fields ), nlons, nb_fields * nlats );
+            eckit::linalg::Matrix C( scl_fourier, nb_fourier, nb_fields * nlats );
+            linalg_.gemm( A, B, C );
+            free_aligned( fourier_dir );
+        }
+#else
+        throw_NotImplemented( "Direct Fourier transform without FFT is not implemented for TRANSLOCAL_DGEMM2", Here() );
+#endif
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::dirtrans_fourier_reduced( const int nlats, const StructuredGrid& g, const int nb_fields,
+                                           const double gp_fields[], double scl_fourier[],
+                                           const eckit::Configuration& ) const {
+    // Fourier transformation:
+    if ( useFFT_ ) {
+#if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
+        {
+            ATLAS_TRACE( "Direct Fourier Transform (FFTW, ReducedGrid)" );
+            const int nb_threads = static_cast<int>( fftw_->in.size() );
+            std::vector<idx_t> jgp_begin( nlats + 1, 0 );
+            for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                const idx_t nx = g.nx( jlat + jlatFourierBegin_ );
+                ATLAS_ASSERT( nx == nlonsGlobal_[jlat + jlatFourierBegin_] );
+                jgp_begin[jlat + 1] = jgp_begin[jlat] + nx;
+            }
+            const int nb_groups = static_cast<int>( fftw_->groups.size() );
+            atlas_omp_pragma( omp parallel for schedule( dynamic, 1 ) num_threads( nb_threads ) )
+            for ( int jgrpfld = 0; jgrpfld < nb_groups * nb_fields; jgrpfld++ ) {
+                const int jgroup               = jgrpfld / nb_fields;
+                const int jfld                 = jgrpfld % nb_fields;
+                const std::vector<idx_t>& lats = fftw_->groups[jgroup];
+                const int nlons                = nlonsGlobal_[lats[0] + jlatFourierBegin_];
+                const int num_complex          = ( nlons / 2 ) + 1;
+                const double scale             = 1. / nlons;
+                fftw_complex* in               = fftw_->in[atlas_omp_get_thread_num()];
+                double* out                    = fftw_->out[atlas_omp_get_thread_num()];
+                for ( size_t jbatch = 0; jbatch < lats.size(); jbatch++ ) {
+                    const int jlat = lats[jbatch];
+                    double* outj   = out + jbatch * nlons;
+                    idx_t jgp      = jfld * jgp_begin[nlats] + jgp_begin[jlat];
+                    for ( int jlon = 0; jlon < nlons; jlon++ ) {
+                        outj[jlon] = gp_fields[jgp++];
+                    }
+                }
+                fftw_execute_dft_r2c( fftw_->dirplans[jgroup], out, in );
+                for ( size_t jbatch = 0; jbatch < lats.size(); jbatch++ ) {
+                    const int jlat          = lats[jbatch];
+                    const fftw_complex* inj = in + jbatch * num_complex;
+                    for ( int jm = 0; jm <= truncation_; jm++ ) {
+                        for ( int imag = 0; imag < 2; imag++ ) {
+                            scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] =
+                                ( jm < num_complex ? inj[jm][imag] * scale : 0. );
+                        }
+                    }
+                }
+            }
+        }
+#endif
+    }
+    else {
+        throw_NotImplemented(
+            "Using dgemm in Fourier transform for reduced grids is extremely slow. Please install and use FFTW!",
+            Here() );
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+// Direct Legendre transform using the same precomputed (or cached) Legendre polynomials as
+// invtrans_legendre. The Fourier coefficients of both hemispheres are combined into a
+// symmetric and an antisymmetric part and weighted with the Gaussian quadrature weights.
+// Latitudes that are skipped by the inverse transform (nlat0_) are skipped here as well.
+// The spectra contain the total wavenumbers up to truncation, which is truncation_ or truncation_+1.
+void TransLocal::dirtrans_legendre( const int truncation, const int nlats, const int nb_fields,
+                                    const double scl_fourier[], double scalar_spectra[],
+                                    const eckit::Configuration& config ) const {
+    if ( single_precision_ ) {
+        dirtrans_legendre_impl<float>( truncation, nlats, nb_fields, scl_fourier, scalar_spectra, config );
+    }
+    else {
+        dirtrans_legendre_impl<double>( truncation, nlats, nb_fields, scl_fourier, scalar_spectra, config );
+    }
+}
+
+template <typename T>
+void TransLocal::dirtrans_legendre_impl( const int truncation, const int nlats, const int nb_fields,
+                                         const double scl_fourier[], double scalar_spectra[],
+                                         const eckit::Configuration& ) const {
+    ATLAS_TRACE( "Direct Legendre Transform (GEMM)" );
+    std::unique_ptr<LegendreBlocks<T>> legendre(
+        legendre_on_the_fly_
+            ? new LegendreBlocks<T>( truncation_ + 1, nlatsLegReduced_, legendre_lats_, legendre_blocksize_,
+                                     zonal_wavenumbers_ )
+            : new LegendreBlocks<T>( truncation_ + 1, nlatsLegReduced_,
+                                     legendre_values<T>( legendre_sym_, legendre_sym_sp_ ),
+                                     legendre_values<T>( legendre_asym_, legendre_asym_sp_ ), legendre_sym_begin_,
+                                     legendre_asym_begin_ ) );
+    const detail::LegendreCompression<T>* compression =
+        legendre_compression<T>( legendre_compression_.get(), legendre_compression_sp_.get() );
+    LegendreScratch<T> scratch( nb_fields, truncation_, nlatsLegReduced_ );
+    const int nb_m                 = static_cast<int>( zonal_wavenumbers_.size() );
+    const std::vector<idx_t> ioffs = spectral_offsets( truncation, nb_fields, zonal_wavenumbers_ );
+
+    // the contributions of all blocks of latitudes are summed up
+    for ( idx_t j = 0; j < ioffs[nb_m]; j++ ) {
+        scalar_spectra[j] = 0.;
+    }
+    for ( int jblk = 0; jblk < legendre->size(); jblk++ ) {
+        legendre->select( jblk );
+        // threaded over zonal wavenumbers; the work per wavenumber decreases with jm
+        atlas_omp_pragma( omp parallel for schedule( dynamic, 1 ) num_threads( scratch.nb_threads ) )
+        for ( int jml = 0; jml < nb_m; jml++ ) {
+            const int jm         = zonal_wavenumbers_[jml];
+            size_t size_sym      = num_n( truncation_ + 1, jm, true );
+            size_t size_asym     = num_n( truncation_ + 1, jm, false );
+            const int n_imag     = ( jm ? 2 : 1 );
+            const int jlat_begin = std::max<int>( legendre->jlat_begin(), nlat0_[jm] );
+            const int nlatsm     = legendre->jlat_end() - jlat_begin;
+            const idx_t ioff     = ioffs[jml];
+            if ( nlatsm > 0 ) {
+                const int thread    = atlas_omp_get_thread_num();
+                T* scl_fourier_sym  = scratch.fourier_sym( thread );
+                T* scl_fourier_asym = scratch.fourier_asym( thread );
+                T* scalar_sym       = scratch.spectral_sym( thread );
+                T* scalar_asym      = scratch.spectral_asym( thread );
+                // butterfly compressed polynomials cover all latitudes (they are only used if precomputed)
+                // and are applied to work arrays with the field index running fastest
+                const LegendreButterfly<T>* butterfly_sym  = compression ? compression->sym[jm].get() : nullptr;
+                const LegendreButterfly<T>* butterfly_asym = compression ? compression->asym[jm].get() : nullptr;
+                const int nb_vectors                       = nb_fields * n_imag;
+                auto pos = [&]( const bool field_fastest, const int j, const int size, const int jfld,
+                                const int imag ) {
+                    const int jvec = jfld + nb_fields * imag;
+                    return field_fastest ? jvec + nb_vectors * j : j + size * jvec;
+                };
+                {
+                    //ATLAS_TRACE( "split spheres" );
+                    for ( int jl = 0; jl < nlatsm; jl++ ) {
+                        const int jlat  = jlat_begin + jl;   // northern hemisphere
+                        const int jslat = nlats - jlat - 1;  // southern hemisphere
+                        const double w  = quadrature_weights_[jlat];
+                        for ( int imag = 0; imag < n_imag; imag++ ) {
+                            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                                const double north =
+                                    scl_fourier[posMethod( jfld, imag, jlat, jml, nb_fields, nlats, nb_m )];
+                                const double south =
+                                    scl_fourier[posMethod( jfld, imag, jslat, jml, nb_fields, nlats, nb_m )];
+
+                                scl_fourier_sym[pos( butterfly_sym, jl, nlatsm, jfld, imag )] =
+                                    static_cast<T>( w * ( north + south ) );
+                                scl_fourier_asym[pos( butterfly_asym, jl, nlatsm, jfld, imag )] =
+                                    static_cast<T>( w * ( north - south ) );
+                            }
+                        }
+                    }
+                }
+                if ( butterfly_sym ) {
+                    butterfly_sym->apply_transpose( scl_fourier_sym, scalar_sym, nb_vectors );
+                }
+                else {
+                    gemm( linalg_, legendre->sym( jm, jlat_begin ), scl_fourier_sym, scalar_sym, size_sym, nlatsm,
+                          nb_vectors );
+                }
+                if ( butterfly_asym ) {
+                    butterfly_asym->apply_transpose( scl_fourier_asym, scalar_asym, nb_vectors );
+                }
+                else if ( size_asym > 0 ) {
+                    gemm( linalg_, legendre->asym( jm, jlat_begin ), scl_fourier_asym, scalar_asym, size_asym, nlatsm,
+                          nb_vectors );
+                }
+                {
+                    //ATLAS_TRACE( "merge spectra" );
+                    // total wavenumbers are stored in descending order in the Legendre polynomials
+                    // (see invtrans_legendre)
+                    size_t is = 0, ia = 0;
+                    for ( int jn = truncation_ + 1; jn >= jm; jn-- ) {
+                        const bool sym = ( ( jn - jm ) % 2 == 0 );
+                        if ( jn <= truncation ) {
+                            for ( int imag = 0; imag < n_imag; imag++ ) {
+                                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                                    idx_t idx = jfld + nb_fields * ( imag + 2 * ( jn - jm ) );
+                                    scalar_spectra[idx + ioff] +=
+                                        sym ? scalar_sym[pos( butterfly_sym, is, size_sym, jfld, imag )]
+                                            : scalar_asym[pos( butterfly_asym, ia, size_asym, jfld, imag )];
+                                }
+                            }
+                        }
+                        ( sym ? is : ia )++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+// Routine to compute the spectral coefficients of vorticity and divergence, the inverse of vd2uv (see VorDivToUV).
+// uv_spectra contains the Legendre transforms of u/cos(latitude) and v/cos(latitude) with the truncation increased
+// by one; for every coefficient the u components of all fields are followed by the v components.
+// In grid point space vor = 1/(a*cos^2(phi)) * ( dV/dlambda - cos(phi)*d(U*cos(phi))/dphi ) and
+// div = 1/(a*cos^2(phi)) * ( dU/dlambda + cos(phi)*d(V*cos(phi))/dphi ) with U = u*cos(phi), V = v*cos(phi).
+// After integration by parts, the derivative acts on the Legendre polynomials instead, and
+// (1-mu^2)*dP(n)/dmu = -n*epsilon(n+1)*P(n+1) + (n+1)*epsilon(n)*P(n-1), see eq.(2.13) in [Temperton 1991].
+void uv_to_vordiv( const int truncation, const int nb_fields, const double uv_spectra[], double vorticity_spectra[],
+                   double divergence_spectra[] ) {
+    const double ra_inv = 1. / util::Earth::radius();
+    auto epsilon        = []( const int n, const int m ) {
+        return ( n > m ) ? std::sqrt( ( n * n - m * m ) / ( 4. * n * n - 1. ) ) : 0.;
+    };
+    int k = 0;
+    for ( int m = 0; m <= truncation; m++ ) {  // zonal wavenumber
+        const int ioff = ( 2 * truncation + 5 - m ) * m / 2 * nb_fields * 4;
+        // coefficient of u (ivar=0) or v (ivar=1) in the increased truncation (zero outside)
+        auto uv = [&]( const int ivar, const int n, const int imag, const int jfld ) {
+            return ( n >= m && n <= truncation + 1 )
+                       ? uv_spectra[ioff + jfld + nb_fields * ( ivar + 2 * ( imag + 2 * ( n - m ) ) )]
+                       : 0.;
+        };
+        for ( int n = m; n <= truncation; n++ ) {  // total wavenumber
+            const double cp1 = -n * epsilon( n + 1, m ) * ra_inv;
+            const double cm1 = ( n + 1 ) * epsilon( n, m ) * ra_inv;
+            for ( int imag = 0; imag < 2; imag++ ) {  // real/imaginary part
+                // multiplication with i*m
+                const double sign = ( imag == 0 ? -m : m ) * ra_inv;
+                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                    vorticity_spectra[k] = sign * uv( 1, n, 1 - imag, jfld ) + cp1 * uv( 0, n + 1, imag, jfld ) +
+                                           cm1 * uv( 0, n - 1, imag, jfld );
+                    divergence_spectra[k] = sign * uv( 0, n, 1 - imag, jfld ) - cp1 * uv( 1, n + 1, imag, jfld ) -
+                                            cm1 * uv( 1, n - 1, imag, jfld );
+                    k++;
+                }
+            }
+        }
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::dirtrans_wind2vordiv( const Field& gpwind, Field& spvor, Field& spdiv,
                                        const eckit::Configuration& config ) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+    int nb_vordiv_fields    = 1;
+    const auto gp_fields    = array::make_view<double, 2>( gpwind );
+    auto vorticity_spectra  = array::make_view<double, 1>( spvor );
+    auto divergence_spectra = array::make_view<double, 1>( spdiv );
+
+    if ( gp_fields.shape( 1 ) == grid().size() && gp_fields.shape( 0 ) == 2 ) {
+        dirtrans( nb_vordiv_fields, gp_fields.data(), vorticity_spectra.data(), divergence_spectra.data(), config );
+    }
+    else if ( gp_fields.shape( 0 ) == grid().size() && gp_fields.shape( 1 ) == 2 ) {
+        array::ArrayT<double> gpwind_t( gp_fields.shape( 1 ), gp_fields.shape( 0 ) );
+        auto gp_fields_t = array::make_view<double, 2>( gpwind_t );
+        gp_transpose( grid().size(), 2, gp_fields.data(), gp_fields_t.data() );
+        dirtrans( nb_vordiv_fields, gp_fields_t.data(), vorticity_spectra.data(), divergence_spectra.data(),
+                  config );
+    }
+    else {
+        ATLAS_NOTIMPLEMENTED;
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
+// Direct spectral transform for global Gaussian grids (regular or reduced):
+// a Fourier transform per latitude followed by a Legendre transform with Gaussian quadrature.
 void TransLocal::dirtrans( const int nb_fields, const double scalar_fields[], double scalar_spectra[],
-                           const eckit::Configuration& ) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+                           const eckit::Configuration& config ) const {
+    if ( quadrature_weights_.empty() ) {
+        throw_NotImplemented( "TransLocal::dirtrans is only implemented for global Gaussian grids", Here() );
+    }
+    if ( distributed_ ) {
+        dirtrans_distributed( nb_fields, scalar_fields, scalar_spectra, config );
+    }
+    else if ( nb_fields > 0 ) {
+        ATLAS_TRACE( "TransLocal::dirtrans" );
+        auto g               = StructuredGrid( grid_ );
+        int nlats            = g.ny();
+        int nlons            = g.nxmax();
+        int size_fourier_max = nb_fields * 2 * nlats;
+        double* scl_fourier;
+        alloc_aligned( scl_fourier, size_fourier_max * ( truncation_ + 1 ) );
+
+        // Fourier transformation:
+        if ( RegularGrid( gridGlobal_ ) ) {
+            dirtrans_fourier_regular( nlats, nlons, nb_fields, scalar_fields, scl_fourier, config );
+        }
+        else {
+            dirtrans_fourier_reduced( nlats, g, nb_fields, scalar_fields, scl_fourier, config );
+        }
+
+        // Legendre transformation:
+        dirtrans_legendre( truncation_, nlats, nb_fields, scl_fourier, scalar_spectra, config );
+
+        free_aligned( scl_fourier );
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
+// Direct transform of wind fields to vorticity and divergence: u/cos(latitude) and v/cos(latitude) are transformed
+// like scalar fields, with the truncation increased by one, and combined in spectral space (see uv_to_vordiv).
+// wind_fields contains the u components of all fields followed by the v components (as returned by invtrans).
 void TransLocal::dirtrans( const int nb_fields, const double wind_fields[], double vorticity_spectra[],
-                           double divergence_spectra[], const eckit::Configuration& ) const {
-    ATLAS_NOTIMPLEMENTED;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+                           double divergence_spectra[], const eckit::Configuration& config ) const {
+    if ( quadrature_weights_.empty() ) {
+        throw_NotImplemented( "TransLocal::dirtrans is only implemented for global Gaussian grids", Here() );
+    }
+    if ( distributed_ ) {
+        throw_NotImplemented( "TransLocal: distributed transforms are only implemented for scalar fields", Here() );
+    }
+    if ( nb_fields > 0 ) {
+        ATLAS_TRACE( "TransLocal::dirtrans" );
+        auto g               = StructuredGrid( grid_ );
+        int nlats            = g.ny();
+        int nlons            = g.nxmax();
+        int nb_uv_fields     = 2 * nb_fields;
+        int size_fourier_max = nb_uv_fields * 2 * nlats;
+
+        std::vector<double> uv_fields( nb_uv_fields * grid_.size() );
+        {
+            ATLAS_TRACE( "compute u/cos,v/cos from u,v" );
+            int idx = 0;
+            for ( idx_t jfld = 0; jfld < nb_uv_fields; jfld++ ) {
+                for ( idx_t jlat = 0; jlat < g.ny(); jlat++ ) {
+                    double lat       = std::max( -latPole, std::min( latPole, g.y( jlat ) ) );
+                    double coslatinv = 1. / std::cos( lat * util::Constants::degreesToRadians() );
+                    for ( idx_t jlon = 0; jlon < g.nx( jlat ); jlon++ ) {
+                        uv_fields[idx] = wind_fields[idx] * coslatinv;
+                        idx++;
+                    }
+                }
+            }
+        }
+
+        double* scl_fourier;
+        alloc_aligned( scl_fourier, size_fourier_max * ( truncation_ + 1 ) );
+
+        // Fourier transformation:
+        if ( RegularGrid( gridGlobal_ ) ) {
+            dirtrans_fourier_regular( nlats, nlons, nb_uv_fields, uv_fields.data(), scl_fourier, config );
+        }
+        else {
+            dirtrans_fourier_reduced( nlats, g, nb_uv_fields, uv_fields.data(), scl_fourier, config );
+        }
+
+        // Legendre transformation:
+        std::vector<double> uv_spectra( 2 * legendre_size( truncation_ + 1 ) * nb_uv_fields );
+        dirtrans_legendre( truncation_ + 1, nlats, nb_uv_fields, scl_fourier, uv_spectra.data(), config );
+
+        free_aligned( scl_fourier );
+
+        {
+            ATLAS_TRACE( "UV to vordiv" );
+            uv_to_vordiv( truncation_, nb_fields, uv_spectra.data(), vorticity_spectra, divergence_spectra );
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+// Distributed inverse transform of scalar fields (see setup_distribution): Legendre transforms of the zonal
+// wavenumbers of this task for all latitudes, transposition to the bands of latitudes, Fourier transforms of the
+// band of this task and transposition of the grid point values to the tasks owning them.
+void TransLocal::invtrans_distributed( const int nb_fields, const double scalar_spectra[], double gp_fields[],
+                                       const eckit::Configuration& config ) const {
+    ATLAS_TRACE( "TransLocal::invtrans_distributed" );
+    const auto& comm   = mpi::comm();
+    const int nb_parts = static_cast<int>( comm.size() );
+    const int part     = static_cast<int>( comm.rank() );
+    StructuredGrid g( grid_ );
+    const int nlats      = g.ny();
+    const int nb_m       = static_cast<int>( zonal_wavenumbers_.size() );
+    const int nlats_band = jlat_begin_part_[part + 1] - jlatFourierBegin_;
+    const idx_t nb_gp      = nb_gridpoints();
+    const idx_t nb_gp_band = static_cast<idx_t>( gp_band_order_.size() );
+    std::vector<int> send_counts( nb_parts );
+    std::vector<int> recv_counts( nb_parts );
+
+    // Legendre transformation:
+    std::vector<double> scl_fourier( nb_fields * 2 * nlats * nb_m, 0. );
+    invtrans_legendre( truncation_, nlats, nb_fields, 0, scalar_spectra, scl_fourier.data(), config );
+
+    // Transposition from zonal wavenumbers to latitudes:
+    std::vector<double> fourier_band( nb_fields * 2 * nlats_band * ( truncation_ + 1 ), 0. );
+    {
+        ATLAS_TRACE( "transposition to latitudes" );
+        for ( int p = 0; p < nb_parts; p++ ) {
+            send_counts[p] = nb_fields * 2 * nb_m * ( jlat_begin_part_[p + 1] - jlat_begin_part_[p] );
+            recv_counts[p] = nb_fields * 2 * static_cast<int>( zonal_wavenumbers_part_[p].size() ) * nlats_band;
+        }
+        const std::vector<int> send_displs = displacements( send_counts );
+        const std::vector<int> recv_displs = displacements( recv_counts );
+        std::vector<double> send( send_displs[nb_parts] );
+        std::vector<double> recv( recv_displs[nb_parts] );
+        size_t k = 0;
+        for ( int p = 0; p < nb_parts; p++ ) {
+            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                for ( idx_t jlat = jlat_begin_part_[p]; jlat < jlat_begin_part_[p + 1]; jlat++ ) {
+                    for ( int jml = 0; jml < nb_m; jml++ ) {
+                        for ( int imag = 0; imag < 2; imag++ ) {
+                            send[k++] = scl_fourier[posMethod( jfld, imag, jlat, jml, nb_fields, nlats, nb_m )];
+                        }
+                    }
+                }
+            }
+        }
+        ATLAS_TRACE_MPI( ALLTOALL ) {
+            comm.allToAllv( send.data(), send_counts.data(), send_displs.data(), recv.data(), recv_counts.data(),
+                            recv_displs.data() );
+        }
+        k = 0;
+        for ( int p = 0; p < nb_parts; p++ ) {
+            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                for ( int jlat = 0; jlat < nlats_band; jlat++ ) {
+                    for ( int jm : zonal_wavenumbers_part_[p] ) {
+                        for ( int imag = 0; imag < 2; imag++ ) {
+                            fourier_band[posMethod( jfld, imag, jlat, jm, nb_fields, nlats_band )] = recv[k++];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Fourier transformation of the band of latitudes:
+    std::vector<double> gp_band( nb_fields * nb_gp_band );
+    if ( nlats_band > 0 ) {
+        if ( RegularGrid( gridGlobal_ ) ) {
+            invtrans_fourier_regular( nlats_band, g.nxmax(), nb_fields, fourier_band.data(), gp_band.data(), config );
+        }
+        else {
+            invtrans_fourier_reduced( nlats_band, g, nb_fields, fourier_band.data(), gp_band.data(), config );
+        }
+    }
+
+    // Transposition from latitudes to the grid point distribution:
+    {
+        ATLAS_TRACE( "transposition to grid points" );
+        for ( int p = 0; p < nb_parts; p++ ) {
+            send_counts[p] = nb_fields * gp_send_counts_[p];
+            recv_counts[p] = nb_fields * gp_recv_counts_[p];
+        }
+        const std::vector<int> send_displs = displacements( send_counts );
+        const std::vector<int> recv_displs = displacements( recv_counts );
+        std::vector<double> send( send_displs[nb_parts] );
+        std::vector<double> recv( recv_displs[nb_parts] );
+        size_t k        = 0;
+        idx_t jgp_begin = 0;
+        for ( int p = 0; p < nb_parts; p++ ) {
+            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                for ( int jgp = 0; jgp < gp_send_counts_[p]; jgp++ ) {
+                    send[k++] = gp_band[gp_band_order_[jgp_begin + jgp] + nb_gp_band * jfld];
+                }
+            }
+            jgp_begin += gp_send_counts_[p];
+        }
+        ATLAS_TRACE_MPI( ALLTOALL ) {
+            comm.allToAllv( send.data(), send_counts.data(), send_displs.data(), recv.data(), recv_counts.data(),
+                            recv_displs.data() );
+        }
+        // grid points received from band p precede those of band p+1, all in the order of their global index
+        k         = 0;
+        jgp_begin = 0;
+        for ( int p = 0; p < nb_parts; p++ ) {
+            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                for ( int jgp = 0; jgp < gp_recv_counts_[p]; jgp++ ) {
+                    gp_fields[jgp_begin + jgp + nb_gp * jfld] = recv[k++];
+                }
+            }
+            jgp_begin += gp_recv_counts_[p];
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+// Distributed direct transform of scalar fields, the reverse of invtrans_distributed.
+void TransLocal::dirtrans_distributed( const int nb_fields, const double gp_fields[], double scalar_spectra[],
+                                       const eckit::Configuration& config ) const {
+    ATLAS_TRACE( "TransLocal::dirtrans_distributed" );
+    const auto& comm   = mpi::comm();
+    const int nb_parts = static_cast<int>( comm.size() );
+    const int part     = static_cast<int>( comm.rank() );
+    StructuredGrid g( grid_ );
+    const int nlats      = g.ny();
+    const int nb_m       = static_cast<int>( zonal_wavenumbers_.size() );
+    const int nlats_band = jlat_begin_part_[part + 1] - jlatFourierBegin_;
+    const idx_t nb_gp      = nb_gridpoints();
+    const idx_t nb_gp_band = static_cast<idx_t>( gp_band_order_.size() );
+    std::vector<int> send_counts( nb_parts );
+    std::vector<int> recv_counts( nb_parts );
+
+    // Transposition from the grid point distribution to latitudes:
+    std::vector<double> gp_band( nb_fields * nb_gp_band );
+    {
+        ATLAS_TRACE( "transposition to latitudes" );
+        for ( int p = 0; p < nb_parts; p++ ) {
+            send_counts[p] = nb_fields * gp_recv_counts_[p];
+            recv_counts[p] = nb_fields * gp_send_counts_[p];
+        }
+        const std::vector<int> send_displs = displacements( send_counts );
+        const std::vector<int> recv_displs = displacements( recv_counts );
+        std::vector<double> send( send_displs[nb_parts] );
+        std::vector<double> recv( recv_displs[nb_parts] );
+        size_t k        = 0;
+        idx_t jgp_begin = 0;
+        for ( int p = 0; p < nb_parts; p++ ) {
+            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                for ( int jgp = 0; jgp < gp_recv_counts_[p]; jgp++ ) {
+                    send[k++] = gp_fields[jgp_begin + jgp + nb_gp * jfld];
+                }
+            }
+            jgp_begin += gp_recv_counts_[p];
+        }
+        ATLAS_TRACE_MPI( ALLTOALL ) {
+            comm.allToAllv( send.data(), send_counts.data(), send_displs.data(), recv.data(), recv_counts.data(),
+                            recv_displs.data() );
+        }
+        k         = 0;
+        jgp_begin = 0;
+        for ( int p = 0; p < nb_parts; p++ ) {
+            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                for ( int jgp = 0; jgp < gp_send_counts_[p]; jgp++ ) {
+                    gp_band[gp_band_order_[jgp_begin + jgp] + nb_gp_band * jfld] = recv[k++];
+                }
+            }
+            jgp_begin += gp_send_counts_[p];
+        }
+    }
+
+    // Fourier transformation of the band of latitudes:
+    std::vector<double> fourier_band( nb_fields * 2 * nlats_band * ( truncation_ + 1 ) );
+    if ( nlats_band > 0 ) {
+        if ( RegularGrid( gridGlobal_ ) ) {
+            dirtrans_fourier_regular( nlats_band, g.nxmax(), nb_fields, gp_band.data(), fourier_band.data(), config );
+        }
+        else {
+            dirtrans_fourier_reduced( nlats_band, g, nb_fields, gp_band.data(), fourier_band.data(), config );
+        }
+    }
+
+    // Transposition from latitudes to zonal wavenumbers:
+    std::vector<double> scl_fourier( nb_fields * 2 * nlats * nb_m );
+    {
+        ATLAS_TRACE( "transposition to zonal wavenumbers" );
+        for ( int p = 0; p < nb_parts; p++ ) {
+            send_counts[p] = nb_fields * 2 * static_cast<int>( zonal_wavenumbers_part_[p].size() ) * nlats_band;
+            recv_counts[p] = nb_fields * 2 * nb_m * ( jlat_begin_part_[p + 1] - jlat_begin_part_[p] );
+        }
+        const std::vector<int> send_displs = displacements( send_counts );
+        const std::vector<int> recv_displs = displacements( recv_counts );
+        std::vector<double> send( send_displs[nb_parts] );
+        std::vector<double> recv( recv_displs[nb_parts] );
+        size_t k = 0;
+        for ( int p = 0; p < nb_parts; p++ ) {
+            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                for ( int jlat = 0; jlat < nlats_band; jlat++ ) {
+                    for ( int jm : zonal_wavenumbers_part_[p] ) {
+                        for ( int imag = 0; imag < 2; imag++ ) {
+                            send[k++] = fourier_band[posMethod( jfld, imag, jlat, jm, nb_fields, nlats_band )];
+                        }
+                    }
+                }
+            }
+        }
+        ATLAS_TRACE_MPI( ALLTOALL ) {
+            comm.allToAllv( send.data(), send_counts.data(), send_displs.data(), recv.data(), recv_counts.data(),
+                            recv_displs.data() );
+        }
+        k = 0;
+        for ( int p = 0; p < nb_parts; p++ ) {
+            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                for ( idx_t jlat = jlat_begin_part_[p]; jlat < jlat_begin_part_[p + 1]; jlat++ ) {
+                    for ( int jml = 0; jml < nb_m; jml++ ) {
+                        for ( int imag = 0; imag < 2; imag++ ) {
+                            scl_fourier[posMethod( jfld, imag, jlat, jml, nb_fields, nlats, nb_m )] = recv[k++];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Legendre transformation:
+    dirtrans_legendre( truncation_, nlats, nb_fields, scl_fourier.data(), scalar_spectra, config );
 }
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -15,6 +15,7 @@
 
 #include "atlas/array.h"
 #include "atlas/functionspace/Spectral.h"
+#include "atlas/grid/Distribution.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/trans/detail/TransImpl.h"
 
@@ -42,6 +43,8 @@ namespace trans {
 
 namespace detail {
 struct FFTW_Data;
+template <typename T>
+struct LegendreCompression;
 }
 
 class LegendreCacheCreatorLocal;
@@ -64,8 +67,32 @@ int fourier_truncation( const int truncation,  // truncation
 ///  - support multiple fields
 ///  - support atlas::Field and atlas::FieldSet based on function spaces
 ///
-/// @note: Direct transforms are not implemented and cannot be unless
-///        the grid is global. There are no plans to support this at the moment.
+/// Option "single_precision" stores the Legendre polynomials (and cache) in single
+/// precision and performs the Legendre transforms in single precision.
+///
+/// Option "precompute" = false on structured grids recomputes the Legendre polynomials
+/// inside the Legendre transforms for blocks of "legendre_blocksize" (default 16) latitudes,
+/// instead of storing them for all latitudes. This trades compute for memory at high truncation.
+///
+/// Option "legendre_tolerance" > 0 (default 0) on structured grids compresses the precomputed Legendre polynomials
+/// of every zonal wavenumber with a butterfly decomposition of accuracy "legendre_tolerance" (relative to the
+/// largest norm of a polynomial over the latitudes), down to blocks of "legendre_leafsize" (default 32) latitudes
+/// and total wavenumbers. The Legendre transforms then need O(N^2 log N) instead of O(N^3) operations, which only
+/// pays off at high truncation (above T1000 or so); zonal wavenumbers for which the compression does not reduce
+/// the number of operations keep using the dense polynomials.
+///
+/// Option "distributed" = true on global structured grids distributes the scalar transforms over the MPI
+/// tasks: the Legendre transforms over the zonal wavenumbers of the Spectral function space (see spectral()),
+/// the Fourier transforms over bands of latitudes, with all-to-all transpositions in between. Grid point
+/// values are those owned by the task in the distribution of option "partitioner" (default "equal_regions",
+/// as StructuredColumns), in the order of their global index.
+///
+/// Gradients (invtrans_grad) are returned with the east-west derivative as first and the
+/// north-south derivative as second variable, on a sphere with the Earth radius (as TransIFS).
+///
+/// @note: Direct transforms are only implemented for scalar fields on global
+///        Gaussian grids (regular or reduced). They use Gaussian quadrature and
+///        share the Legendre polynomials (and cache) with the inverse transforms.
 class TransLocal : public trans::TransImpl {
 public:
     TransLocal( const Grid&, const long truncation, const eckit::Configuration& = util::NoConfig() );
@@ -78,7 +105,7 @@ public:
 
     virtual int truncation() const override { return truncation_; }
 
-    virtual size_t nb_spectral_coefficients() const override { return ( truncation_ + 1 ) * ( truncation_ + 2 ); }
+    virtual size_t nb_spectral_coefficients() const override;
     virtual size_t nb_spectral_coefficients_global() const override {
         return ( truncation_ + 1 ) * ( truncation_ + 2 );
     }
@@ -114,28 +141,35 @@ public:
                            const double divergence_spectra[], double gp_fields[],
                            const eckit::Configuration& = util::NoConfig() ) const override;
 
-    // -- NOT SUPPORTED -- //
-
     virtual void dirtrans( const Field& gpfield, Field& spfield,
                            const eckit::Configuration& = util::NoConfig() ) const override;
 
     virtual void dirtrans( const FieldSet& gpfields, FieldSet& spfields,
                            const eckit::Configuration& = util::NoConfig() ) const override;
 
-    virtual void dirtrans_wind2vordiv( const Field& gpwind, Field& spvor, Field& spdiv,
-                                       const eckit::Configuration& = util::NoConfig() ) const override;
-
     virtual void dirtrans( const int nb_fields, const double scalar_fields[], double scalar_spectra[],
                            const eckit::Configuration& = util::NoConfig() ) const override;
 
+    virtual void dirtrans_wind2vordiv( const Field& gpwind, Field& spvor, Field& spdiv,
+                                       const eckit::Configuration& = util::NoConfig() ) const override;
+
     virtual void dirtrans( const int nb_fields, const double wind_fields[], double vorticity_spectra[],
                            double divergence_spectra[], const eckit::Configuration& = util::NoConfig() ) const override;
 
+    /// @brief Number of zonal wavenumbers with butterfly compressed Legendre polynomials (option "legendre_tolerance")
+    int nb_compressed_zonal_wavenumbers() const;
+
 private:
     int posMethod( const int jfld, const int imag, const int jlat, const int jm, const int nb_fields,
                    const int nlats ) const {
+        return posMethod( jfld, imag, jlat, jm, nb_fields, nlats, truncation_ + 1 );
+    }
+
+    // position in Fourier coefficients holding nb_m zonal wavenumbers (jm is the index of the zonal wavenumber)
+    int posMethod( const int jfld, const int imag, const int jlat, const int jm, const int nb_fields, const int nlats,
+                   const int nb_m ) const {
 #if !TRANSLOCAL_DGEMM2
-        return imag + 2 * ( jm + ( truncation_ + 1 ) * ( jlat + nlats * jfld ) );
+        return imag + 2 * ( jm + nb_m * ( jlat + nlats * jfld ) );
 #else
         return jfld + nb_fields * ( jlat + nlats * ( imag + 2 * ( jm ) ) );
 #endif
@@ -145,6 +179,11 @@ private:
                             const double scalar_spectra[], double scl_fourier[],
                             const eckit::Configuration& config ) const;
 
+    template <typename T>
+    void invtrans_legendre_impl( const int truncation, const int nlats, const int nb_fields,
+                                 const int nb_vordiv_fields, const double scalar_spectra[], double scl_fourier[],
+                                 const eckit::Configuration& config ) const;
+
     void invtrans_fourier_regular( const int nlats, const int nlons, const int nb_fields, double scl_fourier[],
                                    double gp_fields[], const eckit::Configuration& config ) const;
 
@@ -163,6 +202,43 @@ private:
                       const double scalar_spectra[], double gp_fields[],
                       const eckit::Configuration& = util::NoConfig() ) const;
 
+    void invtrans_grad( const int nb_fields, const double scalar_spectra[], double gp_fields[],
+                        const eckit::Configuration& config ) const;
+
+    void dirtrans_fourier_regular( const int nlats, const int nlons, const int nb_fields, const double gp_fields[],
+                                   double scl_fourier[], const eckit::Configuration& config ) const;
+
+    void dirtrans_fourier_reduced( const int nlats, const StructuredGrid& g, const int nb_fields,
+                                   const double gp_fields[], double scl_fourier[],
+                                   const eckit::Configuration& config ) const;
+
+    void dirtrans_legendre( const int truncation, const int nlats, const int nb_fields, const double scl_fourier[],
+                            double scalar_spectra[], const eckit::Configuration& config ) const;
+
+    template <typename T>
+    void dirtrans_legendre_impl( const int truncation, const int nlats, const int nb_fields,
+                                 const double scl_fourier[], double scalar_spectra[],
+                                 const eckit::Configuration& config ) const;
+
+    void invtrans_distributed( const int nb_fields, const double scalar_spectra[], double gp_fields[],
+                               const eckit::Configuration& config ) const;
+
+    void dirtrans_distributed( const int nb_fields, const double gp_fields[], double scalar_spectra[],
+                               const eckit::Configuration& config ) const;
+
+    void setup_distribution( const eckit::Configuration& config );
+
+    idx_t nb_gridpoints() const;
+
+    template <typename T>
+    void precompute_legendre( const std::vector<double>& lats, size_t size_sym, size_t size_asym, T*& legendre_sym,
+                              T*& legendre_asym, const eckit::Configuration& config );
+
+    template <typename T>
+    void compress_legendre( const T* legendre_sym, const T* legendre_asym,
+                            std::unique_ptr<detail::LegendreCompression<T>>& compression,
+                            const eckit::Configuration& config ) const;
+
     bool warning( const eckit::Configuration& = util::NoConfig() ) const;
 
     friend class LegendreCacheCreatorLocal;
@@ -175,6 +251,7 @@ private:
     bool dgemmMethod1_;
     bool unstruct_precomp_;
     bool no_symmetry_;
+    bool single_precision_;
     int truncation_;
     idx_t nlatsNH_;
     idx_t nlatsSH_;
@@ -187,16 +264,37 @@ private:
     idx_t nlonsMaxGlobal_;
     std::vector<idx_t> nlonsGlobal_;
     std::vector<idx_t> nlat0_;
+    std::vector<double> quadrature_weights_;  // northern hemisphere, only for global Gaussian grids
     idx_t nlatsGlobal_;
     bool precompute_;
     double* legendre_;
-    double* legendre_sym_;
-    double* legendre_asym_;
+    double* legendre_sym_{nullptr};
+    double* legendre_asym_{nullptr};
+    float* legendre_sym_sp_{nullptr};   // single precision variant of legendre_sym_
+    float* legendre_asym_sp_{nullptr};  // single precision variant of legendre_asym_
     double* fourier_;
     double* fouriertp_;
     std::vector<size_t> legendre_begin_;
     std::vector<size_t> legendre_sym_begin_;
     std::vector<size_t> legendre_asym_begin_;
+    bool legendre_on_the_fly_{false};    // structured grids with precompute=false
+    int legendre_blocksize_{0};          // number of latitudes per block if legendre_on_the_fly_
+    std::vector<double> legendre_lats_;  // latitudes (radians) of the Legendre polynomials if legendre_on_the_fly_
+    std::unique_ptr<detail::LegendreCompression<double>> legendre_compression_;   // if "legendre_tolerance" > 0
+    std::unique_ptr<detail::LegendreCompression<float>> legendre_compression_sp_;  // single precision variant
+
+    // structured grids: zonal wavenumbers of the Legendre transforms (of this MPI task if distributed_),
+    // in the order of the spectral data
+    std::vector<int> zonal_wavenumbers_;
+
+    bool distributed_{false};
+    std::vector<std::vector<int>> zonal_wavenumbers_part_;  // zonal wavenumbers of every MPI task
+    std::vector<idx_t> jlat_begin_part_;                    // first latitude of the Fourier transforms of every task
+    idx_t jlatFourierBegin_{0};                             // first latitude of the Fourier transforms of this task
+    grid::Distribution distribution_;                       // distribution of the grid point values
+    std::vector<int> gp_send_counts_;   // number of grid points of the band of latitudes owned by every task
+    std::vector<int> gp_recv_counts_;   // number of grid points owned by this task in the band of every task
+    std::vector<idx_t> gp_band_order_;  // grid points of the band of latitudes in the order of the owning tasks
 
     Cache cache_;
     Cache export_legendre_;
@@ -59,5 +59,13 @@ checksum_t checksum( const checksum_t values[], size_t size ) {
     return checksum( reinterpret_cast<const char*>( &values[0] ), size * sizeof( checksum_t ) / sizeof( char ) );
 }
 
+checksum_t checksum_combine( checksum_t seed, checksum_t value ) {
+    // Finalizer of splitmix64, applied to seed and value
+    uint64_t z = uint64_t( seed ) * 0x9e3779b97f4a7c15ULL + uint64_t( value );
+    z          = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+    z          = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+    return checksum_t( z ^ ( z >> 31 ) );
+}
+
 }  // namespace util
 }  // namespace atlas
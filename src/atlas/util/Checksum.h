@@ -23,5 +23,8 @@ checksum_t checksum( const float values[], size_t size );
 checksum_t checksum( const double values[], size_t size );
 checksum_t checksum( const checksum_t values[], size_t size );
 
+/// @brief Mix value into seed, so that the result depends on both
+checksum_t checksum_combine( checksum_t seed, checksum_t value );
+
 }  // namespace util
 }  // namespace atlas
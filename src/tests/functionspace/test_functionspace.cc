@@ -8,6 +8,10 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "eckit/types/Types.h"
 
 #include "atlas/array/ArrayView.h"
@@ -36,6 +40,121 @@ namespace test {
 
 //-----------------------------------------------------------------------------
 
+// Reproducible values that differ between all points, halo points included
+void fill_halo_exchange_test_values( Field& field, double seed ) {
+    double* value = field.data<double>();
+    for ( idx_t j = 0; j < field.size(); ++j ) {
+        value[j] = std::sin( seed * ( j + 1 ) + 100. * mpi::comm().rank() );
+    }
+}
+
+// Dot product over all points of all tasks, halo points included
+double halo_exchange_test_dot_product( const Field& a, const Field& b ) {
+    const double* va = a.data<double>();
+    const double* vb = b.data<double>();
+    double dot       = 0.;
+    for ( idx_t j = 0; j < a.size(); ++j ) {
+        dot += va[j] * vb[j];
+    }
+    mpi::comm().allReduceInPlace( dot, eckit::mpi::sum() );
+    return dot;
+}
+
+// Checks that the adjoint halo exchange H^T satisfies < H x, y > == < x, H^T y >
+template <typename FunctionSpaceT>
+void check_adjoint_halo_exchange( const FunctionSpaceT& fs, const eckit::Configuration& config, bool vector ) {
+    auto create_field = [&]() {
+        Field field = fs.template createField<double>( config );
+        if ( vector ) {
+            field.metadata().set( "type", "vector" );
+        }
+        return field;
+    };
+    Field x   = create_field();
+    Field Hx  = create_field();
+    Field y   = create_field();
+    Field HTy = create_field();
+    fill_halo_exchange_test_values( x, 0.1 );
+    fill_halo_exchange_test_values( Hx, 0.1 );
+    fill_halo_exchange_test_values( y, 0.7 );
+    fill_halo_exchange_test_values( HTy, 0.7 );
+
+    fs.haloExchange( Hx );
+    fs.adjointHaloExchange( HTy );
+
+    const double Hx_y  = halo_exchange_test_dot_product( Hx, y );
+    const double x_HTy = halo_exchange_test_dot_product( x, HTy );
+    Log::info() << "rank " << Hx.rank() << ( vector ? " vector" : " scalar" ) << " field: < H x, y > = " << Hx_y
+                << " , < x, H^T y > = " << x_HTy << std::endl;
+    EXPECT( std::abs( Hx_y - x_HTy ) < 1.e-12 * std::abs( Hx_y ) );
+}
+
+//-----------------------------------------------------------------------------
+
+// Owned points get a value unique to their global index, level and variable; halo points get -1
+template <typename T>
+void fill_owned_values( Field& field, const Mesh& mesh ) {
+    auto ghost         = array::make_view<int, 1>( mesh.nodes().ghost() );
+    auto glb_idx       = array::make_view<gidx_t, 1>( mesh.nodes().global_index() );
+    const idx_t stride = field.size() / field.shape( 0 );
+    T* value           = field.data<T>();
+    for ( idx_t n = 0; n < field.shape( 0 ); ++n ) {
+        for ( idx_t j = 0; j < stride; ++j ) {
+            value[n * stride + j] = ghost( n ) ? T( -1 ) : T( glb_idx( n ) * stride + j );
+        }
+    }
+}
+
+template <typename T>
+double sum_owned_values( const Field& field, const Mesh& mesh ) {
+    auto ghost         = array::make_view<int, 1>( mesh.nodes().ghost() );
+    const idx_t stride = field.size() / field.shape( 0 );
+    const T* value     = field.data<T>();
+    double sum         = 0.;
+    for ( idx_t n = 0; n < field.shape( 0 ); ++n ) {
+        for ( idx_t j = 0; j < stride; ++j ) {
+            sum += ghost( n ) ? 0. : value[n * stride + j];
+        }
+    }
+    return sum;
+}
+
+template <typename T>
+bool equal_values( const Field& field, const Field& reference ) {
+    const T* value     = field.data<T>();
+    const T* ref_value = reference.data<T>();
+    return field.size() == reference.size() && std::equal( value, value + field.size(), ref_value );
+}
+
+//-----------------------------------------------------------------------------
+
+void fill_owned_values( Field& field, const Mesh& mesh ) {
+    if ( field.datatype() == array::DataType::kind<int>() ) {
+        fill_owned_values<int>( field, mesh );
+    }
+    else if ( field.datatype() == array::DataType::kind<float>() ) {
+        fill_owned_values<float>( field, mesh );
+    }
+    else {
+        fill_owned_values<double>( field, mesh );
+    }
+}
+
+bool equal_values( const Field& field, const Field& reference ) {
+    if ( field.datatype() != reference.datatype() ) {
+        return false;
+    }
+    if ( field.datatype() == array::DataType::kind<int>() ) {
+        return equal_values<int>( field, reference );
+    }
+    if ( field.datatype() == array::DataType::kind<float>() ) {
+        return equal_values<float>( field, reference );
+    }
+    return equal_values<double>( field, reference );
+}
+
+//-----------------------------------------------------------------------------
+
 CASE( "test_functionspace_NodeColumns_no_halo" ) {
     Grid grid( "O8" );
     Mesh mesh = StructuredMeshGenerator().generate( grid );
@@ -469,6 +588,183 @@ CASE( "test_functionspace_NodeColumns" ) {
                                       option::name( "tmp" ) );
 }
 
+CASE( "test_functionspace_NodeColumns adjoint halo exchange" ) {
+    Grid grid( "O8" );
+    Mesh mesh = StructuredMeshGenerator().generate( grid );
+    functionspace::NodeColumns fs( mesh, option::halo( 1 ) | option::levels( 3 ) );
+
+    SECTION( "scalar" ) { check_adjoint_halo_exchange( fs, util::Config(), false ); }
+    SECTION( "surface scalar" ) { check_adjoint_halo_exchange( fs, option::levels( false ), false ); }
+    SECTION( "vector" ) { check_adjoint_halo_exchange( fs, option::variables( 2 ), true ); }
+}
+
+CASE( "test_functionspace_NodeColumns split-phase halo exchange" ) {
+    Grid grid( "O8" );
+    Mesh mesh = StructuredMeshGenerator().generate( grid );
+    functionspace::NodeColumns fs( mesh, option::halo( 1 ) | option::levels( 3 ) );
+
+    Field reference = fs.createField<double>( option::variables( 2 ) );
+    fill_owned_values<double>( reference, mesh );
+    fs.haloExchange( reference );
+    const double owned_sum = sum_owned_values<double>( reference, mesh );
+
+    SECTION( "Field" ) {
+        Field field = fs.createField<double>( option::variables( 2 ) );
+        fill_owned_values<double>( field, mesh );
+        field.set_dirty();
+
+        auto handle = field.haloExchangeStart();
+        EXPECT( handle.active() );
+        EXPECT( field.dirty() );
+        // Owned values can be used while the exchange is in flight
+        EXPECT( sum_owned_values<double>( field, mesh ) == owned_sum );
+        handle.wait();
+
+        EXPECT( !field.dirty() );
+        EXPECT( equal_values<double>( field, reference ) );
+    }
+
+    SECTION( "FieldSet" ) {
+        FieldSet fieldset;
+        fieldset.add( fs.createField<double>( option::name( "a" ) | option::variables( 2 ) ) );
+        fieldset.add( fs.createField<double>( option::name( "b" ) | option::variables( 2 ) ) );
+        for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+            fill_owned_values<double>( fieldset[f], mesh );
+        }
+        fieldset.set_dirty();
+
+        auto handle = fieldset.haloExchangeStart();
+        EXPECT( handle.active() );
+        for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+            EXPECT( fieldset[f].dirty() );
+            EXPECT( sum_owned_values<double>( fieldset[f], mesh ) == owned_sum );
+        }
+        handle.wait();
+
+        for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+            EXPECT( !fieldset[f].dirty() );
+            EXPECT( equal_values<double>( fieldset[f], reference ) );
+        }
+    }
+}
+
+CASE( "test_functionspace_NodeColumns fused halo exchange" ) {
+    Grid grid( "O8" );
+    Mesh mesh = StructuredMeshGenerator().generate( grid );
+    functionspace::NodeColumns fs( mesh, option::halo( 1 ) | option::levels( 3 ) );
+
+    // Fields of different ranks and datatypes, and a double field exchanged in single precision,
+    // so that the fused exchange is split in one message for each wire precision
+    FieldSet fieldset;
+    fieldset.add( fs.createField<double>( option::name( "surface" ) | option::levels( false ) ) );
+    fieldset.add( fs.createField<double>( option::name( "scalar" ) ) );
+    fieldset.add( fs.createField<double>( option::name( "vector" ) | option::variables( 2 ) ) );
+    fieldset.add( fs.createField<float>( option::name( "float" ) ) );
+    fieldset.add( fs.createField<int>( option::name( "int" ) | option::levels( false ) ) );
+    fieldset.add( fs.createField<double>( option::name( "single_precision_halo" ) ) );
+    fieldset["single_precision_halo"].set_single_precision_halo();
+
+    // Each field exchanged on its own gives the reference
+    FieldSet reference;
+    for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+        reference.add( fs.createField( fieldset[f], option::name( fieldset[f].name() ) ) );
+        reference[f].set_single_precision_halo( fieldset[f].single_precision_halo() );
+        fill_owned_values( fieldset[f], mesh );
+        fill_owned_values( reference[f], mesh );
+        fs.haloExchange( reference[f] );
+    }
+
+    fieldset.set_dirty();
+    fs.haloExchange( fieldset );
+
+    for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+        Log::info() << "fused halo exchange of field " << fieldset[f].name() << std::endl;
+        EXPECT( !fieldset[f].dirty() );
+        EXPECT( equal_values( fieldset[f], reference[f] ) );
+    }
+}
+
+CASE( "test_functionspace_NodeColumns partial halo exchange" ) {
+    Grid grid( "O8" );
+    Mesh mesh = StructuredMeshGenerator().generate( grid );
+    functionspace::NodeColumns fs( mesh, option::halo( 2 ) | option::levels( 3 ) );
+
+    Field reference = fs.createField<double>();
+    fill_owned_values<double>( reference, mesh );
+    fs.haloExchange( reference );
+
+    auto halo_level = array::make_view<int, 1>( mesh.nodes().halo() );
+    auto ref_value  = array::make_view<double, 2>( reference );
+
+    Field field = fs.createField<double>();
+    auto value  = array::make_view<double, 2>( field );
+    fill_owned_values<double>( field, mesh );
+
+    EXPECT( fs.halo().size() == 2 );
+    for ( idx_t halo = 0; halo <= fs.halo().size(); ++halo ) {
+        field.set_dirty();
+        fs.haloExchange( field, option::halo( halo ) );
+        EXPECT( field.dirty() == ( halo < fs.halo().size() ) );
+        idx_t nb_updated = 0;
+        for ( idx_t n = 0; n < fs.nb_nodes(); ++n ) {
+            for ( idx_t k = 0; k < fs.levels(); ++k ) {
+                EXPECT( value( n, k ) == ( halo_level( n ) <= halo ? ref_value( n, k ) : -1. ) );
+            }
+            nb_updated += ( halo_level( n ) == halo );
+        }
+        // Each level of the halo of this mesh has nodes, across the poles
+        EXPECT( nb_updated > 0 );
+    }
+}
+
+CASE( "test_functionspace_NodeColumns single precision halo" ) {
+    Grid grid( "O8" );
+    Mesh mesh = StructuredMeshGenerator().generate( grid );
+    functionspace::NodeColumns fs( mesh, option::halo( 1 ) | option::levels( 3 ) );
+
+    auto ghost   = array::make_view<int, 1>( mesh.nodes().ghost() );
+    auto glb_idx = array::make_view<gidx_t, 1>( mesh.nodes().global_index() );
+
+    // Values that are not representable in single precision
+    auto fill = [&]( Field& field ) {
+        auto value = array::make_view<double, 2>( field );
+        for ( idx_t n = 0; n < fs.nb_nodes(); ++n ) {
+            for ( idx_t k = 0; k < fs.levels(); ++k ) {
+                value( n, k ) = ghost( n ) ? -1. : glb_idx( n ) + ( k + 1 ) / 3.;
+            }
+        }
+    };
+
+    Field reference = fs.createField<double>();
+    fill( reference );
+    fs.haloExchange( reference );
+
+    Field field = fs.createField<double>();
+    fill( field );
+    field.set_single_precision_halo();
+    EXPECT( field.single_precision_halo() );
+    fs.haloExchange( field );
+
+    auto value       = array::make_view<double, 2>( field );
+    auto ref_value   = array::make_view<double, 2>( reference );
+    idx_t nb_rounded = 0;
+    for ( idx_t n = 0; n < fs.nb_nodes(); ++n ) {
+        for ( idx_t k = 0; k < fs.levels(); ++k ) {
+            if ( ghost( n ) ) {
+                EXPECT( std::abs( value( n, k ) - ref_value( n, k ) ) <=
+                        std::numeric_limits<float>::epsilon() * std::abs( ref_value( n, k ) ) );
+                EXPECT( value( n, k ) == double( float( ref_value( n, k ) ) ) );
+                nb_rounded += ( value( n, k ) != ref_value( n, k ) );
+            }
+            else {
+                EXPECT( value( n, k ) == ref_value( n, k ) );
+            }
+        }
+    }
+    // Halo values went through single precision
+    EXPECT( nb_rounded > 0 );
+}
+
 CASE( "test_SpectralFunctionSpace" ) {
     idx_t truncation = 159;
     idx_t nb_levels  = 10;
@@ -8,12 +8,15 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <cmath>
+
 #include "eckit/log/Bytes.h"
 #include "eckit/types/Types.h"
 
 #include "atlas/array/ArrayView.h"
 #include "atlas/array/MakeView.h"
 #include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
 #include "atlas/functionspace/NodeColumns.h"
 #include "atlas/functionspace/StructuredColumns.h"
 #include "atlas/grid/Partitioner.h"
@@ -37,6 +40,57 @@ namespace test {
 
 //-----------------------------------------------------------------------------
 
+// Reproducible values that differ between all points, halo points included
+void fill_halo_exchange_test_values( Field& field, double seed ) {
+    double* value = field.data<double>();
+    for ( idx_t j = 0; j < field.size(); ++j ) {
+        value[j] = std::sin( seed * ( j + 1 ) + 100. * mpi::comm().rank() );
+    }
+}
+
+// Dot product over all points of all tasks, halo points included
+double halo_exchange_test_dot_product( const Field& a, const Field& b ) {
+    const double* va = a.data<double>();
+    const double* vb = b.data<double>();
+    double dot       = 0.;
+    for ( idx_t j = 0; j < a.size(); ++j ) {
+        dot += va[j] * vb[j];
+    }
+    mpi::comm().allReduceInPlace( dot, eckit::mpi::sum() );
+    return dot;
+}
+
+// Checks that the adjoint halo exchange H^T satisfies < H x, y > == < x, H^T y >
+template <typename FunctionSpaceT>
+void check_adjoint_halo_exchange( const FunctionSpaceT& fs, const eckit::Configuration& config, bool vector ) {
+    auto create_field = [&]() {
+        Field field = fs.template createField<double>( config );
+        if ( vector ) {
+            field.metadata().set( "type", "vector" );
+        }
+        return field;
+    };
+    Field x   = create_field();
+    Field Hx  = create_field();
+    Field y   = create_field();
+    Field HTy = create_field();
+    fill_halo_exchange_test_values( x, 0.1 );
+    fill_halo_exchange_test_values( Hx, 0.1 );
+    fill_halo_exchange_test_values( y, 0.7 );
+    fill_halo_exchange_test_values( HTy, 0.7 );
+
+    fs.haloExchange( Hx );
+    fs.adjointHaloExchange( HTy );
+
+    const double Hx_y  = halo_exchange_test_dot_product( Hx, y );
+    const double x_HTy = halo_exchange_test_dot_product( x, HTy );
+    Log::info() << "rank " << Hx.rank() << ( vector ? " vector" : " scalar" ) << " field: < H x, y > = " << Hx_y
+                << " , < x, H^T y > = " << x_HTy << std::endl;
+    EXPECT( std::abs( Hx_y - x_HTy ) < 1.e-12 * std::abs( Hx_y ) );
+}
+
+//-----------------------------------------------------------------------------
+
 CASE( "test_functionspace_StructuredColumns_no_halo" ) {
     size_t root          = 0;
     std::string gridname = eckit::Resource<std::string>( "--grid", "O8" );
@@ -96,6 +150,69 @@ CASE( "test_functionspace_StructuredColumns_no_halo" ) {
     }
 }
 
+CASE( "test_functionspace_StructuredColumns_gather round-robin" ) {
+    Grid grid( "O8" );
+    util::Config config;
+    config.set( "halo", 0 );
+    functionspace::StructuredColumns fs( grid, grid::Partitioner( "equal_regions" ), config );
+
+    const idx_t nproc     = mpi::comm().size();
+    const idx_t nb_fields = 4;
+    auto glb_idx          = array::make_view<gidx_t, 1>( fs.global_index() );
+
+    FieldSet fields;
+    FieldSet fields_glb;
+    for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+        const idx_t owner = jfield % nproc;
+        Field field       = fs.createField<double>( option::name( "field" + std::to_string( jfield ) ) );
+        Field field_glb   = fs.createField<double>( option::name( "field" + std::to_string( jfield ) ) |
+                                                  option::global( owner ) );
+        auto value = array::make_view<double, 1>( field );
+        for ( idx_t j = 0; j < fs.size(); ++j ) {
+            value( j ) = ( jfield + 1 ) * glb_idx( j );
+        }
+        fields.add( field );
+        fields_glb.add( field_glb );
+    }
+
+    // Gather through the generic FunctionSpace interface
+    FunctionSpace( fs ).gather( fields, fields_glb );
+
+    for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+        if ( mpi::comm().rank() == size_t( jfield % nproc ) ) {
+            auto value_glb = array::make_view<double, 1>( fields_glb[jfield] );
+            EXPECT( value_glb.size() == grid.size() );
+            for ( idx_t j = 0; j < value_glb.size(); ++j ) {
+                EXPECT( value_glb( j ) == ( jfield + 1 ) * ( j + 1 ) );
+            }
+        }
+    }
+}
+
+CASE( "test_functionspace_StructuredColumns checksum independent of decomposition" ) {
+    Grid grid( "O8" );
+    util::Config config;
+    config.set( "halo", 2 );
+
+    auto checksum = [&]( const std::string& partitioner ) {
+        functionspace::StructuredColumns fs( grid, grid::Partitioner( partitioner ), config );
+        Field field  = fs.createField<double>( option::name( "field" ) | option::levels( 3 ) );
+        auto value   = array::make_view<double, 2>( field );
+        auto glb_idx = array::make_view<gidx_t, 1>( fs.global_index() );
+        for ( idx_t j = 0; j < fs.size(); ++j ) {
+            for ( idx_t k = 0; k < 3; ++k ) {
+                value( j, k ) = glb_idx( j ) + 0.1 * k;
+            }
+        }
+        return fs.checksum( field );
+    };
+
+    std::string checksum_equal_regions = checksum( "equal_regions" );
+    std::string checksum_checkerboard  = checksum( "checkerboard" );
+    Log::info() << "field checksum = " << checksum_equal_regions << std::endl;
+    EXPECT( checksum_equal_regions == checksum_checkerboard );
+}
+
 CASE( "test_functionspace_StructuredColumns_halo with output" ) {
     ATLAS_DEBUG_VAR( mpi::comm().size() );
     //  grid::StructuredGrid grid(
@@ -330,6 +447,61 @@ CASE( "test_functionspace_StructuredColumns halo exchange registration" ) {
 
 //-----------------------------------------------------------------------------
 
+CASE( "test_functionspace_StructuredColumns partial halo exchange" ) {
+    std::string gridname = eckit::Resource<std::string>( "--grid", "O8" );
+
+    StructuredGrid grid( gridname );
+
+    util::Config config;
+    config.set( "halo", 2 );
+    config.set( "levels", 3 );
+    config.set( "periodic_points", true );
+    functionspace::StructuredColumns fs( grid, grid::Partitioner( "equal_regions" ), config );
+
+    Field field = fs.createField<long>( option::name( "field" ) );
+
+    auto value      = array::make_view<long, 2>( field );
+    auto glb_idx    = array::make_view<gidx_t, 1>( fs.global_index() );
+    auto ghost      = array::make_view<int, 1>( fs.ghost() );
+    auto halo_level = array::make_view<int, 1>( fs.halo_level() );
+
+    for ( idx_t n = 0; n < fs.size(); ++n ) {
+        EXPECT( ( halo_level( n ) == 0 ) == ( ghost( n ) == 0 ) );
+        EXPECT( halo_level( n ) <= fs.halo() );
+        for ( idx_t k = 0; k < fs.levels(); ++k ) {
+            value( n, k ) = ghost( n ) ? -1 : glb_idx( n );
+        }
+    }
+
+    for ( idx_t halo = 0; halo <= fs.halo(); ++halo ) {
+        fs.haloExchange( field, option::halo( halo ) );
+        EXPECT( field.dirty() == ( halo < fs.halo() ) );
+        for ( idx_t n = 0; n < fs.size(); ++n ) {
+            for ( idx_t k = 0; k < fs.levels(); ++k ) {
+                EXPECT( value( n, k ) == ( halo_level( n ) <= halo ? glb_idx( n ) : -1 ) );
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_functionspace_StructuredColumns adjoint halo exchange" ) {
+    StructuredGrid grid( "O8" );
+
+    util::Config config;
+    config.set( "halo", 2 );
+    config.set( "levels", 3 );
+    config.set( "periodic_points", true );
+    functionspace::StructuredColumns fs( grid, grid::Partitioner( "equal_regions" ), config );
+
+    SECTION( "scalar" ) { check_adjoint_halo_exchange( fs, util::Config(), false ); }
+    // Components of vectors change sign in the halo across the poles
+    SECTION( "vector" ) { check_adjoint_halo_exchange( fs, option::variables( 2 ), true ); }
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
@@ -16,6 +16,7 @@
 #include "atlas/array/ArrayView.h"
 #include "atlas/array/MakeView.h"
 #include "atlas/library/config.h"
+#include "atlas/parallel/Checksum.h"
 #include "atlas/parallel/GatherScatter.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "eckit/utils/Translator.h"
@@ -549,6 +550,29 @@ CASE( "test_gather" ) {
             }
         }
 
+        SECTION( "test_gather_rank0_ArrayView_roots_descending" ) {
+            // Roots other than the one used in setup obtain the global map on first use
+            for ( f.root = f.comm_size - 1; f.root >= 0; --f.root ) {
+                array::ArrayT<POD> loc( f.Nl );
+                array::ArrayT<POD> glb( f.Ng() );
+
+                array::ArrayView<POD, 1> locv = array::make_view<POD, 1>( loc );
+                array::ArrayView<POD, 1> glbv = array::make_view<POD, 1>( glb );
+                for ( int p = 0; p < f.Nl; ++p ) {
+                    locv( p ) = ( size_t( f.part[p] ) != mpi::comm().rank() ? 0 : f.gidx[p] * 10 );
+                }
+
+                f.gather_scatter.gather( locv, glbv, f.root );
+                if ( f.rank == f.root ) {
+                    POD glb_c[] = {10, 20, 30, 40, 50, 60, 70, 80, 90};
+                    EXPECT( glb.shape( 0 ) == 9 );
+                    for ( idx_t n = 0; n < glb.shape( 0 ); ++n ) {
+                        EXPECT( glbv( n ) == glb_c[n] );
+                    }
+                }
+            }
+        }
+
         SECTION( "test_gather_rank1_ArrayView" ) {
             for ( f.root = 0; f.root < f.comm_size; ++f.root ) {
                 array::ArrayT<POD> loc( f.Nl, 2 );
@@ -577,6 +601,93 @@ CASE( "test_gather" ) {
             }
         }
 
+        SECTION( "test_gather_scatter_rank1_ArrayView_parallel_dim1" ) {
+            for ( f.root = 0; f.root < f.comm_size; ++f.root ) {
+                // Level-first layout: parallel dimension is dimension 1
+                array::ArrayT<POD> loc( 2, f.Nl );
+                array::ArrayT<POD> glb( 2, f.Ng() );
+
+                array::ArrayView<POD, 2> locv = array::make_view<POD, 2>( loc );
+                array::ArrayView<POD, 2> glbv = array::make_view<POD, 2>( glb );
+                for ( int p = 0; p < f.Nl; ++p ) {
+                    locv( 0, p ) = ( size_t( f.part[p] ) != mpi::comm().rank() ? 0 : -f.gidx[p] * 10 );
+                    locv( 1, p ) = ( size_t( f.part[p] ) != mpi::comm().rank() ? 0 : f.gidx[p] * 10 );
+                }
+
+                f.gather_scatter.gather( locv, glbv, f.root, 1 );
+                if ( f.rank == f.root ) {
+                    POD glb_c[] = {-10, 10, -20, 20, -30, 30, -40, 40, -50, 50, -60, 60, -70, 70, -80, 80, -90, 90};
+                    idx_t c( 0 );
+                    for ( idx_t i = 0; i < glb.shape( 1 ); ++i ) {
+                        for ( idx_t j = 0; j < glb.shape( 0 ); ++j ) {
+                            EXPECT( glbv( j, i ) == glb_c[c++] );
+                        }
+                    }
+                }
+
+                array::ArrayT<POD> loc2( 2, f.Nl );
+                array::ArrayView<POD, 2> loc2v = array::make_view<POD, 2>( loc2 );
+                loc2v.assign( 0. );
+                f.gather_scatter.scatter( glbv, loc2v, f.root, 1 );
+                for ( int p = 0; p < f.Nl; ++p ) {
+                    EXPECT( loc2v( 0, p ) == locv( 0, p ) );
+                    EXPECT( loc2v( 1, p ) == locv( 1, p ) );
+                }
+            }
+            f.root = 0;
+        }
+
+        SECTION( "test_gather_scatter_rank3_ArrayView_parallel_dim1" ) {
+            // Rank-4 views with the parallel dimension in second position
+            auto value = [&]( int p, int i, int j, int k ) -> POD {
+                return size_t( f.part[p] ) != mpi::comm().rank() ? 0 : f.gidx[p] * ( 1 + 1000 * i + 100 * j + 10 * k );
+            };
+            for ( f.root = 0; f.root < f.comm_size; ++f.root ) {
+                array::ArrayT<POD> loc( 2, f.Nl, 3, 2 );
+                array::ArrayT<POD> glb( 2, f.Ng(), 3, 2 );
+
+                array::ArrayView<POD, 4> locv = array::make_view<POD, 4>( loc );
+                array::ArrayView<POD, 4> glbv = array::make_view<POD, 4>( glb );
+                for ( int i = 0; i < 2; ++i ) {
+                    for ( int p = 0; p < f.Nl; ++p ) {
+                        for ( int j = 0; j < 3; ++j ) {
+                            for ( int k = 0; k < 2; ++k ) {
+                                locv( i, p, j, k ) = value( p, i, j, k );
+                            }
+                        }
+                    }
+                }
+
+                f.gather_scatter.gather( locv, glbv, f.root, 1 );
+                if ( f.rank == f.root ) {
+                    for ( int i = 0; i < 2; ++i ) {
+                        for ( idx_t n = 0; n < glb.shape( 1 ); ++n ) {
+                            for ( int j = 0; j < 3; ++j ) {
+                                for ( int k = 0; k < 2; ++k ) {
+                                    EXPECT( glbv( i, n, j, k ) == ( n + 1 ) * ( 1 + 1000 * i + 100 * j + 10 * k ) );
+                                }
+                            }
+                        }
+                    }
+                }
+
+                array::ArrayT<POD> loc2( 2, f.Nl, 3, 2 );
+                array::ArrayView<POD, 4> loc2v = array::make_view<POD, 4>( loc2 );
+                loc2v.assign( 0. );
+                f.gather_scatter.scatter( glbv, loc2v, f.root, 1 );
+                for ( int i = 0; i < 2; ++i ) {
+                    for ( int p = 0; p < f.Nl; ++p ) {
+                        for ( int j = 0; j < 3; ++j ) {
+                            for ( int k = 0; k < 2; ++k ) {
+                                EXPECT( loc2v( i, p, j, k ) == locv( i, p, j, k ) );
+                            }
+                        }
+                    }
+                }
+            }
+            f.root = 0;
+        }
+
         SECTION( "test_gather_rank2_ArrayView" ) {
             for ( f.root = 0; f.root < f.comm_size; ++f.root ) {
                 array::ArrayT<POD> loc( f.Nl, 3, 2 );
@@ -612,6 +723,79 @@ CASE( "test_gather" ) {
             f.root = 0;
         }
 
+        SECTION( "test_gather_scatter_rank2_streaming" ) {
+            POD glb_c[] = {-1, 1, -10, 10, -100, 100, -2, 2, -20, 20, -200, 200, -3, 3, -30, 30, -300, 300,
+                           -4, 4, -40, 40, -400, 400, -5, 5, -50, 50, -500, 500, -6, 6, -60, 60, -600, 600,
+                           -7, 7, -70, 70, -700, 700, -8, 8, -80, 80, -800, 800, -9, 9, -90, 90, -900, 900};
+            const idx_t nb_levels        = 3;
+            const idx_t levels_per_chunk = 2;
+            for ( f.root = 0; f.root < f.comm_size; ++f.root ) {
+                array::ArrayT<POD> loc( f.Nl, nb_levels, 2 );
+                array::ArrayView<POD, 3> locv = array::make_view<POD, 3>( loc );
+                for ( int p = 0; p < f.Nl; ++p ) {
+                    for ( int i = 0; i < nb_levels; ++i ) {
+                        locv( p, i, 0 ) =
+                            ( size_t( f.part[p] ) != mpi::comm().rank() ? 0 : -f.gidx[p] * std::pow( 10, i ) );
+                        locv( p, i, 1 ) =
+                            ( size_t( f.part[p] ) != mpi::comm().rank() ? 0 : f.gidx[p] * std::pow( 10, i ) );
+                    }
+                }
+
+                // Gather in chunks of levels, reassembling the complete field from the chunks
+                std::vector<POD> glb( f.Ng() * nb_levels * 2, 0. );
+                std::vector<idx_t> chunks;
+                parallel::Field<POD const> lfield( locv );
+                f.gather_scatter.gather( lfield, levels_per_chunk,
+                                         [&]( const POD chunk[], idx_t level_begin, idx_t level_end ) {
+                                             const idx_t nb_chunk_levels = level_end - level_begin;
+                                             chunks.push_back( level_begin );
+                                             for ( idx_t n = 0; n < f.Ng(); ++n ) {
+                                                 for ( idx_t l = 0; l < nb_chunk_levels; ++l ) {
+                                                     for ( idx_t k = 0; k < 2; ++k ) {
+                                                         glb[( n * nb_levels + level_begin + l ) * 2 + k] =
+                                                             chunk[( n * nb_chunk_levels + l ) * 2 + k];
+                                                     }
+                                                 }
+                                             }
+                                         },
+                                         f.root );
+                if ( f.rank == f.root ) {
+                    EXPECT( chunks == std::vector<idx_t>( {0, 2} ) );
+                    EXPECT( glb == std::vector<POD>( glb_c, glb_c + f.Ng() * nb_levels * 2 ) );
+                }
+                else {
+                    EXPECT( chunks.empty() );
+                }
+
+                // Scatter back in chunks of levels
+                array::ArrayT<POD> loc2( f.Nl, nb_levels, 2 );
+                array::ArrayView<POD, 3> loc2v = array::make_view<POD, 3>( loc2 );
+                loc2v.assign( 0. );
+                parallel::Field<POD> lfield2( loc2v );
+                f.gather_scatter.scatter(
+                    [&]( POD chunk[], idx_t level_begin, idx_t level_end ) {
+                        const idx_t nb_chunk_levels = level_end - level_begin;
+                        for ( idx_t n = 0; n < f.Ng(); ++n ) {
+                            for ( idx_t l = 0; l < nb_chunk_levels; ++l ) {
+                                for ( idx_t k = 0; k < 2; ++k ) {
+                                    chunk[( n * nb_chunk_levels + l ) * 2 + k] =
+                                        glb_c[( n * nb_levels + level_begin + l ) * 2 + k];
+                                }
+                            }
+                        }
+                    },
+                    levels_per_chunk, lfield2, f.root );
+                for ( int p = 0; p < f.Nl; ++p ) {
+                    for ( int i = 0; i < nb_levels; ++i ) {
+                        for ( int k = 0; k < 2; ++k ) {
+                            EXPECT( loc2v( p, i, k ) == locv( p, i, k ) );
+                        }
+                    }
+                }
+            }
+            f.root = 0;
+        }
+
         SECTION( "test_scatter_rank2_ArrayView" ) {
             for ( f.root = 0; f.root < f.comm_size; ++f.root ) {
                 array::ArrayT<POD> loc( f.Nl, 3, 2 );
@@ -685,6 +869,25 @@ CASE( "test_gather" ) {
                 }
             }
         }
+
+        SECTION( "test_checksum_duplicated_global_index" ) {
+            std::vector<POD> loc( f.Nl );
+            std::vector<int> mask_ghost( f.Nl );
+            std::vector<int> mask_none( f.Nl );
+            for ( int j = 0; j < f.Nl; ++j ) {
+                loc[j]        = f.gidx[j] * 10;
+                mask_ghost[j] = ( f.part[j] != f.rank );
+                mask_none[j]  = ( f.gidx[j] == 20 );  // nonstandard gidx of a ghost point
+            }
+
+            // Without a mask on ghost points, global indices 1, 2, ..., 9 are included on two tasks
+            parallel::Checksum checksum_ghost;
+            parallel::Checksum checksum_none;
+            checksum_ghost.setup( f.part.data(), f.ridx.data(), 0, f.gidx.data(), mask_ghost.data(), f.Nl );
+            checksum_none.setup( f.part.data(), f.ridx.data(), 0, f.gidx.data(), mask_none.data(), f.Nl );
+
+            EXPECT( checksum_none.execute( loc.data(), 1 ) == checksum_ghost.execute( loc.data(), 1 ) );
+        }
     }
 }
 
@@ -19,6 +19,7 @@
 #include "atlas/library/config.h"
 #include "atlas/parallel/HaloExchange.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/trace/Timings.h"
 
 #include "tests/AtlasTestEnvironment.h"
 
@@ -628,6 +629,281 @@ void test_rank2_paralleldim2( Fixture& f ) {
     }
 }
 
+void test_rank1_reuse_buffers( Fixture& f ) {
+    f.halo_exchange.clear_buffers();
+    EXPECT( f.halo_exchange.buffers_footprint() == 0 );
+
+    array::ArrayT<POD> arr( f.N, 2 );
+    array::ArrayView<POD, 2> arrv = array::make_host_view<POD, 2>( arr );
+
+    size_t footprint{0};
+    for ( int iter = 0; iter < 3; ++iter ) {
+        for ( int j = 0; j < f.N; ++j ) {
+            arrv( j, 0 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] * 10 );
+            arrv( j, 1 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] * 100 );
+        }
+
+        f.halo_exchange.execute<POD, 2>( arr, false );
+
+        if ( iter == 0 ) {
+            footprint = f.halo_exchange.buffers_footprint();
+        }
+        EXPECT( f.halo_exchange.buffers_footprint() == footprint );
+        EXPECT( f.halo_exchange.nb_buffers() == 1 );
+
+        switch ( mpi::comm().rank() ) {
+            case 0: {
+                POD arr_c[] = {90, 900, 10, 100, 20, 200, 30, 300, 40, 400};
+                validate<POD, 2>::apply( arrv, arr_c );
+                break;
+            }
+            case 1: {
+                POD arr_c[] = {30, 300, 40, 400, 50, 500, 60, 600, 70, 700, 80, 800};
+                validate<POD, 2>::apply( arrv, arr_c );
+                break;
+            }
+            case 2: {
+                POD arr_c[] = {50, 500, 60, 600, 70, 700, 80, 800, 90, 900, 10, 100, 20, 200};
+                validate<POD, 2>::apply( arrv, arr_c );
+                break;
+            }
+        }
+    }
+
+    // Exchanges in flight at the same time need their own buffers, which are reused afterwards
+    array::ArrayT<POD> arr2( f.N, 2 );
+    for ( int iter = 0; iter < 3; ++iter ) {
+        parallel::HaloExchangeHandle handle1 = f.halo_exchange.start<POD, 2>( arr, false );
+        parallel::HaloExchangeHandle handle2 = f.halo_exchange.start<POD, 2>( arr2, false );
+        EXPECT( f.halo_exchange.nb_buffers() == 2 );
+        f.halo_exchange.wait( handle1 );
+        f.halo_exchange.wait( handle2 );
+        f.halo_exchange.execute<POD, 2>( arr, false );
+        EXPECT( f.halo_exchange.nb_buffers() == 2 );
+        EXPECT( f.halo_exchange.buffers_footprint() == 2 * footprint );
+    }
+
+    f.halo_exchange.clear_buffers();
+    EXPECT( f.halo_exchange.buffers_footprint() == 0 );
+    EXPECT( f.halo_exchange.nb_buffers() == 0 );
+}
+
+void test_rank1_start_wait( Fixture& f ) {
+    array::ArrayT<POD> arr1( f.N, 2 );
+    array::ArrayT<POD> arr2( f.N, 2 );
+    array::ArrayView<POD, 2> arrv1 = array::make_host_view<POD, 2>( arr1 );
+    array::ArrayView<POD, 2> arrv2 = array::make_host_view<POD, 2>( arr2 );
+    for ( int j = 0; j < f.N; ++j ) {
+        arrv1( j, 0 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] * 10 );
+        arrv1( j, 1 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] * 100 );
+        arrv2( j, 0 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : -f.gidx[j] * 10 );
+        arrv2( j, 1 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : -f.gidx[j] * 100 );
+    }
+
+    // Two exchanges with identical buffer requirements in flight at the same time
+    parallel::HaloExchangeHandle handle1 = f.halo_exchange.start<POD, 2>( arr1, false );
+    parallel::HaloExchangeHandle handle2 = f.halo_exchange.start<POD, 2>( arr2, false );
+    EXPECT( handle1.active() );
+    EXPECT( handle2.active() );
+
+    f.halo_exchange.wait( handle2 );
+    f.halo_exchange.wait( handle1 );
+    EXPECT( !handle1.active() );
+    EXPECT( !handle2.active() );
+
+    switch ( mpi::comm().rank() ) {
+        case 0: {
+            POD arr_c1[] = {90, 900, 10, 100, 20, 200, 30, 300, 40, 400};
+            POD arr_c2[] = {-90, -900, -10, -100, -20, -200, -30, -300, -40, -400};
+            validate<POD, 2>::apply( arrv1, arr_c1 );
+            validate<POD, 2>::apply( arrv2, arr_c2 );
+            break;
+        }
+        case 1: {
+            POD arr_c1[] = {30, 300, 40, 400, 50, 500, 60, 600, 70, 700, 80, 800};
+            POD arr_c2[] = {-30, -300, -40, -400, -50, -500, -60, -600, -70, -700, -80, -800};
+            validate<POD, 2>::apply( arrv1, arr_c1 );
+            validate<POD, 2>::apply( arrv2, arr_c2 );
+            break;
+        }
+        case 2: {
+            POD arr_c1[] = {50, 500, 60, 600, 70, 700, 80, 800, 90, 900, 10, 100, 20, 200};
+            POD arr_c2[] = {-50, -500, -60, -600, -70, -700, -80, -800, -90, -900, -10, -100, -20, -200};
+            validate<POD, 2>::apply( arrv1, arr_c1 );
+            validate<POD, 2>::apply( arrv2, arr_c2 );
+            break;
+        }
+    }
+}
+
+void test_setup_while_in_flight( Fixture& f ) {
+    array::ArrayT<POD> arr( f.N, 2 );
+    parallel::HaloExchangeHandle handle = f.halo_exchange.start<POD, 2>( arr, false );
+
+    // Buffers of the exchange in flight are sized for the current pattern
+    EXPECT_THROWS( f.halo_exchange.setup( f.part.data(), f.ridx.data(), 0, f.N ) );
+    f.halo_exchange.wait( handle );
+
+    f.halo_exchange.setup( f.part.data(), f.ridx.data(), 0, f.N );
+    EXPECT( f.halo_exchange.nb_buffers() == 0 );
+}
+
+void test_fused( Fixture& f ) {
+    array::ArrayT<float> arr1( f.N );
+    array::ArrayT<POD> arr2( f.N, 2 );
+    array::ArrayT<int> arr3( f.N, 3, 1 );
+    auto arrv1 = array::make_host_view<float, 1>( arr1 );
+    auto arrv2 = array::make_host_view<POD, 2>( arr2 );
+    auto arrv3 = array::make_host_view<int, 3>( arr3 );
+    for ( int j = 0; j < f.N; ++j ) {
+        bool owned    = size_t( f.part[j] ) == mpi::comm().rank();
+        arrv1( j )    = owned ? f.gidx[j] : 0;
+        arrv2( j, 0 ) = owned ? f.gidx[j] * 10 : 0;
+        arrv2( j, 1 ) = owned ? f.gidx[j] * 100 : 0;
+        for ( int k = 0; k < 3; ++k ) {
+            arrv3( j, k, 0 ) = owned ? -f.gidx[j] * ( k + 1 ) : 0;
+        }
+    }
+
+    std::vector<array::Array*> arrays{&arr1, &arr2, &arr3};
+    f.halo_exchange.execute( arrays );
+
+    std::vector<POD> gidx_c;
+    switch ( mpi::comm().rank() ) {
+        case 0: {
+            gidx_c = {9, 1, 2, 3, 4};
+            break;
+        }
+        case 1: {
+            gidx_c = {3, 4, 5, 6, 7, 8};
+            break;
+        }
+        case 2: {
+            gidx_c = {5, 6, 7, 8, 9, 1, 2};
+            break;
+        }
+    }
+    for ( int j = 0; j < f.N; ++j ) {
+        EXPECT( arrv1( j ) == float( gidx_c[j] ) );
+        EXPECT( arrv2( j, 0 ) == gidx_c[j] * 10 );
+        EXPECT( arrv2( j, 1 ) == gidx_c[j] * 100 );
+        for ( int k = 0; k < 3; ++k ) {
+            EXPECT( arrv3( j, k, 0 ) == int( -gidx_c[j] * ( k + 1 ) ) );
+        }
+    }
+}
+
+void test_rank1_single_precision( Fixture& f ) {
+    array::ArrayT<double> arr( f.N, 2 );
+    array::ArrayView<double, 2> arrv = array::make_host_view<double, 2>( arr );
+    auto value                       = []( int gidx, int var ) { return gidx + ( var + 1 ) / 3.; };
+    for ( int j = 0; j < f.N; ++j ) {
+        arrv( j, 0 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : value( f.gidx[j], 0 ) );
+        arrv( j, 1 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : value( f.gidx[j], 1 ) );
+    }
+
+    f.halo_exchange.execute<double, 2>( arr, false, parallel::WirePrecision::Single );
+
+    // Owned values are untouched, halo values went over the wire as float
+    for ( int j = 0; j < f.N; ++j ) {
+        for ( int v = 0; v < 2; ++v ) {
+            if ( size_t( f.part[j] ) == mpi::comm().rank() ) {
+                EXPECT( arrv( j, v ) == value( f.gidx[j], v ) );
+            }
+            else {
+                EXPECT( arrv( j, v ) == double( float( value( f.gidx[j], v ) ) ) );
+            }
+        }
+    }
+}
+
+void test_rank1_adjoint( Fixture& f ) {
+    // Dot-product test: < H x, y > == < x, H^T y >
+    array::ArrayT<POD> x( f.N, 2 );
+    array::ArrayT<POD> y( f.N, 2 );
+    array::ArrayView<POD, 2> xv = array::make_host_view<POD, 2>( x );
+    array::ArrayView<POD, 2> yv = array::make_host_view<POD, 2>( y );
+    for ( int j = 0; j < f.N; ++j ) {
+        for ( int v = 0; v < 2; ++v ) {
+            xv( j, v ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] + v );
+            yv( j, v ) = 10 * ( mpi::comm().rank() + 1 ) + j + v;
+        }
+    }
+    auto dot = [&f]( const array::ArrayView<POD, 2>& a, const array::ArrayView<POD, 2>& b ) {
+        POD d = 0;
+        for ( int j = 0; j < f.N; ++j ) {
+            for ( int v = 0; v < 2; ++v ) {
+                d += a( j, v ) * b( j, v );
+            }
+        }
+        mpi::comm().allReduceInPlace( d, eckit::mpi::sum() );
+        return d;
+    };
+
+    f.halo_exchange.execute<POD, 2>( x, false );
+    const POD Hx_dot_y = dot( xv, yv );
+
+    // Restore x to its owned values only
+    for ( int j = 0; j < f.N; ++j ) {
+        for ( int v = 0; v < 2; ++v ) {
+            xv( j, v ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] + v );
+        }
+    }
+
+    f.halo_exchange.execute_adjoint<POD, 2>( y, false );
+    const POD x_dot_HTy = dot( xv, yv );
+
+    EXPECT( Hx_dot_y == x_dot_HTy );
+
+    // The halo of H^T y is zero
+    for ( int j = 0; j < f.N; ++j ) {
+        if ( size_t( f.part[j] ) != mpi::comm().rank() ) {
+            EXPECT( yv( j, 0 ) == 0 );
+            EXPECT( yv( j, 1 ) == 0 );
+        }
+    }
+}
+
+void test_communication_volume( Fixture& f ) {
+    using runtime::trace::Timings;
+    array::ArrayT<POD> arr( f.N, 2 );
+
+    // Communication is only recorded with tracing or the trace report enabled (ATLAS_TRACE_REPORT=1)
+    EXPECT( Timings::communication_enabled() );
+
+    auto before = Timings::communication()["halo-exchange"];
+    f.halo_exchange.execute<POD, 2>( arr, false );
+    auto after = Timings::communication()["halo-exchange"];
+
+    size_t nb_ghosts = 0;
+    for ( int j = 0; j < f.N; ++j ) {
+        if ( size_t( f.part[j] ) != mpi::comm().rank() ) {
+            ++nb_ghosts;
+        }
+    }
+    EXPECT( after.count - before.count == 1 );
+    EXPECT( after.bytes_received - before.bytes_received == nb_ghosts * 2 * sizeof( POD ) );
+    EXPECT( after.neighbours == 2 );
+
+    // Messages to this task itself are not counted
+    EXPECT( after.messages_sent - before.messages_sent <= after.neighbours );
+    EXPECT( after.messages_received - before.messages_received <= after.neighbours );
+
+    // Globally, everything sent is received
+    long bytes_sent        = after.bytes_sent - before.bytes_sent;
+    long bytes_received    = after.bytes_received - before.bytes_received;
+    long messages_sent     = after.messages_sent - before.messages_sent;
+    long messages_received = after.messages_received - before.messages_received;
+    mpi::comm().allReduceInPlace( bytes_sent, eckit::mpi::sum() );
+    mpi::comm().allReduceInPlace( bytes_received, eckit::mpi::sum() );
+    mpi::comm().allReduceInPlace( messages_sent, eckit::mpi::sum() );
+    mpi::comm().allReduceInPlace( messages_received, eckit::mpi::sum() );
+    EXPECT( bytes_sent == bytes_received );
+    EXPECT( messages_sent == messages_received );
+
+    EXPECT( Timings::report().find( "Communication accumulated by label" ) != std::string::npos );
+}
+
 void test_rank1_cinterface( Fixture& f ) {
 #if ATLAS_GRIDTOOLS_STORAGE_BACKEND_HOST
     array::ArrayT<POD> arr( f.N, 2 );
@@ -692,6 +968,20 @@ CASE( "test_haloexchange" ) {
         SECTION( "test_rank2_paralleldim_2" ) { test_rank2_paralleldim2( f ); }
         SECTION( "test_rank1_cinterface" ) { test_rank1_cinterface( f ); }
 
+        SECTION( "test_rank1_reuse_buffers" ) { test_rank1_reuse_buffers( f ); }
+
+        SECTION( "test_rank1_start_wait" ) { test_rank1_start_wait( f ); }
+
+        SECTION( "test_setup_while_in_flight" ) { test_setup_while_in_flight( f ); }
+
+        SECTION( "test_fused" ) { test_fused( f ); }
+
+        SECTION( "test_rank1_single_precision" ) { test_rank1_single_precision( f ); }
+
+        SECTION( "test_rank1_adjoint" ) { test_rank1_adjoint( f ); }
+
+        SECTION( "test_communication_volume" ) { test_communication_volume( f ); }
+
 #if ATLAS_GRIDTOOLS_STORAGE_BACKEND_CUDA
         f.on_device_ = true;
 
@@ -0,0 +1,105 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
+#include "atlas/functionspace/Spectral.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid.h"
+#include "atlas/option.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/trans/Trans.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_trans_distributed" ) {
+    Log::info() << "test_trans_distributed" << std::endl;
+    // compare distributed transforms with global ones, on the grid points owned by this task in a
+    // StructuredColumns function space and the zonal wavenumbers of this task in the Spectral function space
+    int trc = 31;
+    int N   = ( trc + 2 ) * ( trc + 1 ) / 2;
+    Grid g( "O32" );
+    trans::Trans trans( g, trc, option::type( "local" ) );
+    trans::Trans trans_dist( g, trc, option::type( "local" ) | util::Config( "distributed", true ) );
+    functionspace::StructuredColumns gp_fs( g );
+    functionspace::Spectral sp_fs( trans_dist.spectral() );
+
+    std::vector<double> sp( 2 * N );
+    std::vector<double> sp_dir( 2 * N );
+    std::vector<double> gp( g.size() );
+    int k = 0;
+    for ( int m = 0; m <= trc; m++ ) {                // zonal wavenumber
+        for ( int n = m; n <= trc; n++ ) {            // total wavenumber
+            for ( int imag = 0; imag < 2; imag++ ) {  // real/imaginary part
+                sp[k++] = ( m < trc && ( m > 0 || imag == 0 ) ) ? 1. / ( 1. + n + 2. * m + imag ) : 0.;
+            }
+        }
+    }
+    trans.invtrans( 1, sp.data(), gp.data() );
+    trans.dirtrans( 1, gp.data(), sp_dir.data() );
+
+    // local spectral data in the order of the zonal wavenumbers of this task
+    Field spfield = sp_fs.createField<double>( option::name( "sp" ) );
+    Field gpfield = gp_fs.createField<double>( option::name( "gp" ) );
+    auto sp_loc   = array::make_view<double, 1>( spfield );
+    auto gp_loc   = array::make_view<double, 1>( gpfield );
+    auto glb_idx  = array::make_view<gidx_t, 1>( gp_fs.global_index() );
+    std::vector<int> sp_idx;  // index in the global spectral data of every local spectral coefficient
+    const auto zonal_wavenumbers = sp_fs.zonal_wavenumbers();
+    for ( idx_t jm = 0; jm < zonal_wavenumbers.size(); jm++ ) {
+        const int m = zonal_wavenumbers( jm );
+        for ( int n = m; n <= trc; n++ ) {
+            for ( int imag = 0; imag < 2; imag++ ) {
+                sp_idx.push_back( imag + 2 * ( n - m ) + ( 2 * trc + 3 - m ) * m );
+            }
+        }
+    }
+    EXPECT( static_cast<idx_t>( sp_idx.size() ) == spfield.size() );
+    for ( size_t j = 0; j < sp_idx.size(); j++ ) {
+        sp_loc( j ) = sp[sp_idx[j]];
+    }
+
+    trans_dist.invtrans( spfield, gpfield );
+    double err = 0.;
+    for ( idx_t j = 0; j < gp_fs.sizeOwned(); j++ ) {
+        err = std::max( err, std::abs( gp_loc( j ) - gp[glb_idx( j ) - 1] ) );
+    }
+    Log::info() << "maximum difference of distributed invtrans: " << err << std::endl;
+    EXPECT( err < 1.e-12 );
+
+    for ( idx_t j = 0; j < gp_fs.sizeOwned(); j++ ) {
+        gp_loc( j ) = gp[glb_idx( j ) - 1];
+    }
+    trans_dist.dirtrans( gpfield, spfield );
+    err = 0.;
+    for ( size_t j = 0; j < sp_idx.size(); j++ ) {
+        err = std::max( err, std::abs( sp_loc( j ) - sp_dir[sp_idx[j]] ) );
+    }
+    Log::info() << "maximum difference of distributed dirtrans: " << err << std::endl;
+    EXPECT( err < 1.e-12 );
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main( int argc, char** argv ) {
+    return atlas::test::run( argc, argv );
+}
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <iomanip>
 
+#include "eckit/exception/Exceptions.h"
 #include "eckit/utils/MD5.h"
 
 #include "atlas/grid.h"
@@ -263,6 +264,38 @@ CASE( "test cache creator in memory" ) {
     auto trans2 = Trans( cache, grid_global, truncation );
 }
 
+CASE( "test memory mapped cache file" ) {
+    auto truncation = 31;
+    Grid grid( "O32" );
+
+    LegendreCacheCreator legendre_cache_creator( grid, truncation );
+    auto cachefile = CacheFile( "leg_" + legendre_cache_creator.uid() + ".bin" );
+    legendre_cache_creator.create( cachefile );
+
+    trans::TransCacheMappedFileEntry mapped( cachefile );
+    trans::TransCacheFileEntry loaded( cachefile );
+    EXPECT( mapped.size() == loaded.size() );
+    EXPECT( std::equal( static_cast<const char*>( mapped.data() ),
+                        static_cast<const char*>( mapped.data() ) + mapped.size(),
+                        static_cast<const char*>( loaded.data() ) ) );
+
+    // a cache shared between Trans objects, read from the mapped file
+    Cache cache = LegendreCache( cachefile );
+    auto trans1 = Trans( cache, grid, truncation );
+    auto trans2 = Trans( cache, grid, truncation );
+}
+
+CASE( "test cache precision mismatch" ) {
+    auto truncation = 31;
+    Grid grid( "O32" );
+
+    // double precision polynomials can not be used for single precision transforms
+    LegendreCacheCreator legendre_cache_creator( grid, truncation, option::type( "local" ) );
+    Cache cache = legendre_cache_creator.create();
+    EXPECT_THROWS_AS( Trans( cache, grid, truncation, option::type( "local" ) | option::single_precision() ),
+                      eckit::BadParameter );
+}
+
 }  // namespace test
 }  // namespace atlas
 
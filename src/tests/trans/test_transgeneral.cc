@@ -1463,6 +1463,305 @@ CASE( "test_trans_unstructured" ) {
 
 //-----------------------------------------------------------------------------
 
+#if 1
+CASE( "test_trans_dirtrans" ) {
+    Log::info() << "test_trans_dirtrans" << std::endl;
+    // test the direct transform of transgeneral by applying it to the result of the inverse transform
+    int trc = 31;
+    int N   = ( trc + 2 ) * ( trc + 1 ) / 2;
+    for ( std::string gridname : {"F32", "O32"} ) {
+        Grid g( gridname );
+        trans::Trans trans( g, trc, option::type( "local" ) );
+
+        std::vector<double> sp( 2 * N );
+        std::vector<double> sp_dir( 2 * N );
+        std::vector<double> gp( g.size() );
+        int k = 0;
+        for ( int m = 0; m <= trc; m++ ) {                // zonal wavenumber
+            for ( int n = m; n <= trc; n++ ) {            // total wavenumber
+                for ( int imag = 0; imag < 2; imag++ ) {  // real/imaginary part
+                    // the inverse transform ignores m=0 imaginary parts and m=trc
+                    sp[k++] = ( m < trc && ( m > 0 || imag == 0 ) ) ? 1. / ( 1. + n + 2. * m + imag ) : 0.;
+                }
+            }
+        }
+
+        trans.invtrans( 1, sp.data(), gp.data() );
+        trans.dirtrans( 1, gp.data(), sp_dir.data() );
+
+        double err = 0.;
+        for ( int j = 0; j < 2 * N; j++ ) {
+            err = std::max( err, std::abs( sp_dir[j] - sp[j] ) );
+        }
+        Log::info() << gridname << ": maximum error after invtrans and dirtrans: " << err << std::endl;
+        EXPECT( err < 1.e-8 );
+    }
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+#if 1
+CASE( "test_trans_dirtrans_wind2vordiv" ) {
+    Log::info() << "test_trans_dirtrans_wind2vordiv" << std::endl;
+    // test the direct transform of wind to vorticity and divergence by applying it to the result of the inverse
+    // transform of vorticity and divergence
+    int trc = 31;
+    int N   = ( trc + 2 ) * ( trc + 1 ) / 2;
+    for ( std::string gridname : {"F32", "O32"} ) {
+        Grid g( gridname );
+        trans::Trans trans( g, trc, option::type( "local" ) );
+
+        std::vector<double> vor( 2 * N );
+        std::vector<double> div( 2 * N );
+        std::vector<double> vor_dir( 2 * N );
+        std::vector<double> div_dir( 2 * N );
+        std::vector<double> gp( 2 * g.size() );
+        int k = 0;
+        for ( int m = 0; m <= trc; m++ ) {                // zonal wavenumber
+            for ( int n = m; n <= trc; n++ ) {            // total wavenumber
+                for ( int imag = 0; imag < 2; imag++ ) {  // real/imaginary part
+                    // the wind does not depend on the global means (n=0)
+                    bool nonzero = ( m < trc && ( m > 0 || imag == 0 ) && n > 0 );
+                    vor[k]       = nonzero ? 1. / ( 1. + n + 2. * m + imag ) : 0.;
+                    div[k]       = nonzero ? 1. / ( 2. + 2. * n + m + imag ) : 0.;
+                    k++;
+                }
+            }
+        }
+
+        trans.invtrans( 1, vor.data(), div.data(), gp.data() );
+        trans.dirtrans( 1, gp.data(), vor_dir.data(), div_dir.data() );
+
+        double err = 0.;
+        for ( int j = 0; j < 2 * N; j++ ) {
+            err = std::max( err, std::abs( vor_dir[j] - vor[j] ) );
+            err = std::max( err, std::abs( div_dir[j] - div[j] ) );
+        }
+        Log::info() << gridname << ": maximum error after invtrans and dirtrans of wind: " << err << std::endl;
+        EXPECT( err < 1.e-8 );
+
+        // the same with fields, the wind components running fastest
+        Field gpwind( "wind", array::make_datatype<double>(), array::make_shape( g.size(), 2 ) );
+        Field spvor_dir( "vor", vor_dir.data(), array::make_shape( 2 * N ) );
+        Field spdiv_dir( "div", div_dir.data(), array::make_shape( 2 * N ) );
+        auto wind = array::make_view<double, 2>( gpwind );
+        for ( idx_t j = 0; j < g.size(); j++ ) {
+            wind( j, 0 ) = gp[j];
+            wind( j, 1 ) = gp[g.size() + j];
+        }
+        trans.dirtrans_wind2vordiv( gpwind, spvor_dir, spdiv_dir );
+
+        err = 0.;
+        for ( int j = 0; j < 2 * N; j++ ) {
+            err = std::max( err, std::abs( vor_dir[j] - vor[j] ) );
+            err = std::max( err, std::abs( div_dir[j] - div[j] ) );
+        }
+        EXPECT( err < 1.e-8 );
+    }
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+#if 1
+CASE( "test_trans_single_precision" ) {
+    Log::info() << "test_trans_single_precision" << std::endl;
+    // compare transforms using single precision Legendre polynomials with the double precision ones
+    int trc = 31;
+    int N   = ( trc + 2 ) * ( trc + 1 ) / 2;
+    Grid g( "O32" );
+    trans::Trans trans_dp( g, trc, option::type( "local" ) );
+    trans::Trans trans_sp( g, trc, option::type( "local" ) | option::single_precision() );
+
+    std::vector<double> sp( 2 * N );
+    std::vector<double> sp_dir( 2 * N );
+    std::vector<double> gp_dp( g.size() );
+    std::vector<double> gp_sp( g.size() );
+    int k = 0;
+    for ( int m = 0; m <= trc; m++ ) {                // zonal wavenumber
+        for ( int n = m; n <= trc; n++ ) {            // total wavenumber
+            for ( int imag = 0; imag < 2; imag++ ) {  // real/imaginary part
+                sp[k++] = ( m < trc && ( m > 0 || imag == 0 ) ) ? 1. / ( 1. + n + 2. * m + imag ) : 0.;
+            }
+        }
+    }
+
+    trans_dp.invtrans( 1, sp.data(), gp_dp.data() );
+    trans_sp.invtrans( 1, sp.data(), gp_sp.data() );
+    double err = 0.;
+    double max = 0.;
+    for ( size_t j = 0; j < gp_dp.size(); j++ ) {
+        err = std::max( err, std::abs( gp_sp[j] - gp_dp[j] ) );
+        max = std::max( max, std::abs( gp_dp[j] ) );
+    }
+    Log::info() << "maximum difference of single precision invtrans: " << err << std::endl;
+    EXPECT( err < 1.e-5 * max );
+
+    trans_sp.dirtrans( 1, gp_sp.data(), sp_dir.data() );
+    err = 0.;
+    for ( int j = 0; j < 2 * N; j++ ) {
+        err = std::max( err, std::abs( sp_dir[j] - sp[j] ) );
+    }
+    Log::info() << "maximum error after single precision invtrans and dirtrans: " << err << std::endl;
+    EXPECT( err < 1.e-5 );
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+#if 1
+CASE( "test_trans_legendre_on_the_fly" ) {
+    Log::info() << "test_trans_legendre_on_the_fly" << std::endl;
+    // compare transforms computing the Legendre polynomials per block of latitudes with precomputed ones
+    int trc = 31;
+    int N   = ( trc + 2 ) * ( trc + 1 ) / 2;
+    Grid g( "O32" );
+    trans::Trans trans( g, trc, option::type( "local" ) );
+    trans::Trans trans_otf( g, trc,
+                            option::type( "local" ) | util::Config( "precompute", false ) |
+                                util::Config( "legendre_blocksize", 5 ) );
+
+    std::vector<double> sp( 2 * N );
+    std::vector<double> sp_dir( 2 * N );
+    std::vector<double> sp_dir_otf( 2 * N );
+    std::vector<double> gp( g.size() );
+    std::vector<double> gp_otf( g.size() );
+    int k = 0;
+    for ( int m = 0; m <= trc; m++ ) {                // zonal wavenumber
+        for ( int n = m; n <= trc; n++ ) {            // total wavenumber
+            for ( int imag = 0; imag < 2; imag++ ) {  // real/imaginary part
+                sp[k++] = ( m < trc && ( m > 0 || imag == 0 ) ) ? 1. / ( 1. + n + 2. * m + imag ) : 0.;
+            }
+        }
+    }
+
+    trans.invtrans( 1, sp.data(), gp.data() );
+    trans_otf.invtrans( 1, sp.data(), gp_otf.data() );
+    double err = 0.;
+    for ( idx_t j = 0; j < g.size(); j++ ) {
+        err = std::max( err, std::abs( gp_otf[j] - gp[j] ) );
+    }
+    Log::info() << "maximum difference of invtrans with Legendre polynomials on the fly: " << err << std::endl;
+    EXPECT( err < 1.e-12 );
+
+    trans.dirtrans( 1, gp.data(), sp_dir.data() );
+    trans_otf.dirtrans( 1, gp.data(), sp_dir_otf.data() );
+    err = 0.;
+    for ( int j = 0; j < 2 * N; j++ ) {
+        err = std::max( err, std::abs( sp_dir_otf[j] - sp_dir[j] ) );
+    }
+    Log::info() << "maximum difference of dirtrans with Legendre polynomials on the fly: " << err << std::endl;
+    EXPECT( err < 1.e-12 );
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+#if 1
+CASE( "test_trans_legendre_compression" ) {
+    Log::info() << "test_trans_legendre_compression" << std::endl;
+    // compare transforms with butterfly compressed Legendre polynomials with the dense ones. At this truncation
+    // only the polynomials of the largest zonal wavenumbers are compressed, even with a small leaf size.
+    int trc = 159;
+    int N   = ( trc + 2 ) * ( trc + 1 ) / 2;
+    Grid g( "F80" );
+    trans::Trans trans( g, trc, option::type( "local" ) );
+    trans::Trans trans_bf( g, trc,
+                           option::type( "local" ) | option::legendre_tolerance( 1.e-12 ) |
+                               util::Config( "legendre_leafsize", 4 ) );
+
+    const auto& trans_local    = dynamic_cast<const trans::TransLocal&>( *trans.get() );
+    const auto& trans_local_bf = dynamic_cast<const trans::TransLocal&>( *trans_bf.get() );
+    Log::info() << "zonal wavenumbers with compressed Legendre polynomials: "
+                << trans_local_bf.nb_compressed_zonal_wavenumbers() << std::endl;
+    EXPECT( trans_local.nb_compressed_zonal_wavenumbers() == 0 );
+    EXPECT( trans_local_bf.nb_compressed_zonal_wavenumbers() > 0 );
+
+    std::vector<double> sp( 2 * N );
+    std::vector<double> sp_dir( 2 * N );
+    std::vector<double> sp_dir_bf( 2 * N );
+    std::vector<double> gp( g.size() );
+    std::vector<double> gp_bf( g.size() );
+    int k = 0;
+    for ( int m = 0; m <= trc; m++ ) {                // zonal wavenumber
+        for ( int n = m; n <= trc; n++ ) {            // total wavenumber
+            for ( int imag = 0; imag < 2; imag++ ) {  // real/imaginary part
+                sp[k++] = ( m < trc && ( m > 0 || imag == 0 ) ) ? 1. / ( 1. + n + 2. * m + imag ) : 0.;
+            }
+        }
+    }
+
+    trans.invtrans( 1, sp.data(), gp.data() );
+    trans_bf.invtrans( 1, sp.data(), gp_bf.data() );
+    double err = 0.;
+    for ( idx_t j = 0; j < g.size(); j++ ) {
+        err = std::max( err, std::abs( gp_bf[j] - gp[j] ) );
+    }
+    Log::info() << "maximum difference of invtrans with compressed Legendre polynomials: " << err << std::endl;
+    EXPECT( err < 1.e-9 );
+
+    trans.dirtrans( 1, gp.data(), sp_dir.data() );
+    trans_bf.dirtrans( 1, gp.data(), sp_dir_bf.data() );
+    err = 0.;
+    for ( int j = 0; j < 2 * N; j++ ) {
+        err = std::max( err, std::abs( sp_dir_bf[j] - sp_dir[j] ) );
+    }
+    Log::info() << "maximum difference of dirtrans with compressed Legendre polynomials: " << err << std::endl;
+    EXPECT( err < 1.e-9 );
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+#if 1
+CASE( "test_trans_invtrans_grad" ) {
+    Log::info() << "test_trans_invtrans_grad" << std::endl;
+    // compare the gradient from invtrans_grad with the analytic gradient of
+    //   f = sin(phi) + cos(phi)*cos(lambda) + cos(phi)^2*sin(2*lambda)
+    int trc = 31;
+    int N   = ( trc + 2 ) * ( trc + 1 ) / 2;
+    StructuredGrid g( "O32" );
+    trans::Trans trans( g, trc, option::type( "local" ) );
+
+    const double ra      = util::Earth::radius();
+    const double deg2rad = M_PI / 180.;
+    std::vector<double> gp( g.size() );
+    std::vector<double> grad_exact( 2 * g.size() );
+    idx_t n = 0;
+    for ( idx_t jlat = 0; jlat < g.ny(); ++jlat ) {
+        for ( idx_t jlon = 0; jlon < g.nx( jlat ); ++jlon, ++n ) {
+            const double lon = g.x( jlon, jlat ) * deg2rad;
+            const double lat = g.y( jlat ) * deg2rad;
+            const double c   = std::cos( lat );
+            const double s   = std::sin( lat );
+            gp[n]            = s + c * std::cos( lon ) + c * c * std::sin( 2. * lon );
+            // east-west: 1/(a*cos(phi)) df/dlambda, north-south: 1/a df/dphi
+            grad_exact[2 * n]     = ( -std::sin( lon ) + 2. * c * std::cos( 2. * lon ) ) / ra;
+            grad_exact[2 * n + 1] = ( c - s * std::cos( lon ) - 2. * c * s * std::sin( 2. * lon ) ) / ra;
+        }
+    }
+
+    std::vector<double> sp( 2 * N );
+    std::vector<double> grad( 2 * g.size() );
+    Field gpfield( "gp", gp.data(), array::make_shape( g.size() ) );
+    Field spfield( "sp", sp.data(), array::make_shape( 2 * N ) );
+    Field gradfield( "grad", grad.data(), array::make_shape( g.size(), 2 ) );
+
+    trans.dirtrans( gpfield, spfield );
+    trans.invtrans_grad( spfield, gradfield );
+
+    double err = 0.;
+    for ( size_t j = 0; j < grad.size(); j++ ) {
+        err = std::max( err, ra * std::abs( grad[j] - grad_exact[j] ) );
+    }
+    Log::info() << "maximum error of invtrans_grad (scaled with the Earth radius): " << err << std::endl;
+    EXPECT( err < 1.e-7 );
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
 #if 0
 CASE( "test_trans_fourier_truncation" ) {
     Log::info() << "test_trans_fourier_truncation" << std::endl;